@@ -173,6 +173,24 @@ function findVulkan()
     return true
 end
 
+-- Result comparison kernels for vector instruction sets are selected at runtime based on processor features, so only their source files
+-- are compiled with the instruction sets enabled
+function addComparisonKernelOptions()
+    filter { "files:source/tuning_runner/comparison/*_avx2.cpp", "toolset:msc*" }
+        buildoptions { "/arch:AVX2" }
+
+    filter { "files:source/tuning_runner/comparison/*_avx2.cpp", "toolset:not msc*" }
+        buildoptions { "-mavx2", "-mf16c" }
+
+    filter { "files:source/tuning_runner/comparison/*_avx512.cpp", "toolset:msc*" }
+        buildoptions { "/arch:AVX512" }
+
+    filter { "files:source/tuning_runner/comparison/*_avx512.cpp", "toolset:not msc*" }
+        buildoptions { "-mavx512f" }
+
+    filter {}
+end
+
 -- Command line arguments definition
 newoption
 {
@@ -279,6 +297,7 @@ project "ktt"
     includedirs { "source" }
     defines { "KTT_LIBRARY" }
     targetname(ktt_library_name)
+    addComparisonKernelOptions()
 
     local libraries = false
     
@@ -604,6 +623,7 @@ project "tests"
     files { "tests/**.hpp", "tests/**.cpp", "tests/**.cl", "source/**.h", "source/**.hpp", "source/**.cpp" }
     includedirs { "tests", "source" }
     defines { "KTT_TESTS", "DO_NOT_USE_WMAIN" }
+    addComparisonKernelOptions()
     
     if _OPTIONS["no-opencl"] then
         removefiles { "tests/opencl_engine_tests.cpp" }
@@ -8,7 +8,9 @@ ComputationResult::ComputationResult() :
     status(false),
     duration(std::numeric_limits<uint64_t>::max()),
     kernelName(""),
-    errorMessage("")
+    errorMessage(""),
+    censored(false),
+    objectiveValue(std::numeric_limits<double>::max())
 {}
 
 ComputationResult::ComputationResult(const std::string& kernelName, const std::vector<ParameterPair>& configuration, const uint64_t duration,
@@ -19,7 +21,9 @@ ComputationResult::ComputationResult(const std::string& kernelName, const std::v
     errorMessage(""),
     configuration(configuration),
     compilationData(compilationData),
-    profilingData(profilingData)
+    profilingData(profilingData),
+    censored(false),
+    objectiveValue(static_cast<double>(duration))
 {}
 
 ComputationResult::ComputationResult(const std::string& compositionName, const std::vector<ParameterPair>& configuration, const uint64_t duration,
@@ -30,7 +34,9 @@ ComputationResult::ComputationResult(const std::string& compositionName, const s
     errorMessage(""),
     configuration(configuration),
     compositionCompilationData(compilationData),
-    compositionProfilingData(profilingData)
+    compositionProfilingData(profilingData),
+    censored(false),
+    objectiveValue(static_cast<double>(duration))
 {}
 
 ComputationResult::ComputationResult(const std::string& kernelName, const std::vector<ParameterPair>& configuration,
@@ -39,7 +45,9 @@ ComputationResult::ComputationResult(const std::string& kernelName, const std::v
     duration(std::numeric_limits<uint64_t>::max()),
     kernelName(kernelName),
     errorMessage(errorMessage),
-    configuration(configuration)
+    configuration(configuration),
+    censored(false),
+    objectiveValue(std::numeric_limits<double>::max())
 {}
 
 bool ComputationResult::getStatus() const
@@ -87,4 +95,40 @@ const std::map<KernelId, KernelProfilingData>& ComputationResult::getComposition
     return compositionProfilingData;
 }
 
+bool ComputationResult::isCensored() const
+{
+    return censored;
+}
+
+void ComputationResult::setCensored(const bool flag)
+{
+    this->censored = flag;
+}
+
+const MeasurementStatistics& ComputationResult::getMeasurementStatistics() const
+{
+    return measurementStatistics;
+}
+
+void ComputationResult::setMeasurementStatistics(const MeasurementStatistics& statistics)
+{
+    this->measurementStatistics = statistics;
+}
+
+double ComputationResult::getObjectiveValue() const
+{
+    return objectiveValue;
+}
+
+const std::map<std::string, double>& ComputationResult::getObjectiveValues() const
+{
+    return objectiveValues;
+}
+
+void ComputationResult::setObjectiveValues(const double objectiveValue, const std::map<std::string, double>& objectiveValues)
+{
+    this->objectiveValue = objectiveValue;
+    this->objectiveValues = objectiveValues;
+}
+
 } // namespace ktt
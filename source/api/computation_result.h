@@ -9,6 +9,7 @@
 #include <vector>
 #include <api/kernel_compilation_data.h>
 #include <api/kernel_profiling_data.h>
+#include <api/measurement_statistics.h>
 #include <api/parameter_pair.h>
 #include <ktt_platform.h>
 #include <ktt_types.h>
@@ -116,6 +117,37 @@ public:
       */
     const std::map<KernelId, KernelProfilingData>& getCompositionProfilingData() const;
 
+    /** @fn bool isCensored() const
+      * Checks whether measurement of the current configuration was terminated early because it was much slower than the best configuration
+      * found so far. See Tuner::setMeasurementRacing() for more information.
+      * @return True if duration is only lower bound of actual computation duration. False otherwise.
+      */
+    bool isCensored() const;
+
+    /** @fn const MeasurementStatistics& getMeasurementStatistics() const
+      * Getter for statistics of repeated measurements of the current configuration. See Tuner::setMeasurementRepetitions() for more
+      * information.
+      * @return Statistics of repeated measurements. If repeated measurements were not performed, statistics contain single measurement equal to
+      * computation duration. See MeasurementStatistics for more information.
+      */
+    const MeasurementStatistics& getMeasurementStatistics() const;
+
+    /** @fn double getObjectiveValue() const
+      * Getter for value of tuning objective which is minimized during tuning. If no tuning objectives were added for tuned kernel, objective
+      * value is equal to computation duration. Otherwise, it is weighted sum of individual objective values. See Tuner::addObjective() for more
+      * information.
+      * @return Value of tuning objective. If status is false or some of the objective limits are exceeded, maximum value.
+      */
+    double getObjectiveValue() const;
+
+    /** @fn const std::map<std::string, double>& getObjectiveValues() const
+      * Getter for values of individual tuning objectives added for tuned kernel.
+      * @return Values of individual tuning objectives mapped to their names. If no tuning objectives were added, empty map.
+      */
+    const std::map<std::string, double>& getObjectiveValues() const;
+
+    friend class ConfigurationManager;
+
 private:
     bool status;
     uint64_t duration;
@@ -126,6 +158,14 @@ private:
     std::map<KernelId, KernelCompilationData> compositionCompilationData;
     KernelProfilingData profilingData;
     std::map<KernelId, KernelProfilingData> compositionProfilingData;
+    MeasurementStatistics measurementStatistics;
+    bool censored;
+    double objectiveValue;
+    std::map<std::string, double> objectiveValues;
+
+    void setCensored(const bool flag);
+    void setMeasurementStatistics(const MeasurementStatistics& statistics);
+    void setObjectiveValues(const double objectiveValue, const std::map<std::string, double>& objectiveValues);
 };
 
 } // namespace ktt
@@ -0,0 +1,60 @@
+#include <api/kernel_cache_statistics.h>
+
+namespace ktt
+{
+
+KernelCacheStatistics::KernelCacheStatistics() :
+    hitCount(0),
+    missCount(0),
+    evictionCount(0),
+    size(0),
+    capacity(0)
+{}
+
+KernelCacheStatistics::KernelCacheStatistics(const uint64_t hitCount, const uint64_t missCount, const uint64_t evictionCount, const size_t size,
+    const size_t capacity) :
+    hitCount(hitCount),
+    missCount(missCount),
+    evictionCount(evictionCount),
+    size(size),
+    capacity(capacity)
+{}
+
+uint64_t KernelCacheStatistics::getHitCount() const
+{
+    return hitCount;
+}
+
+uint64_t KernelCacheStatistics::getMissCount() const
+{
+    return missCount;
+}
+
+uint64_t KernelCacheStatistics::getEvictionCount() const
+{
+    return evictionCount;
+}
+
+size_t KernelCacheStatistics::getSize() const
+{
+    return size;
+}
+
+size_t KernelCacheStatistics::getCapacity() const
+{
+    return capacity;
+}
+
+double KernelCacheStatistics::getHitRate() const
+{
+    const uint64_t lookupCount = hitCount + missCount;
+
+    if (lookupCount == 0)
+    {
+        return 0.0;
+    }
+
+    return static_cast<double>(hitCount) / static_cast<double>(lookupCount);
+}
+
+} // namespace ktt
@@ -0,0 +1,82 @@
+/** @file kernel_cache_statistics.h
+  * Usage statistics of kernel cache inside compute engine.
+  */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ktt_platform.h>
+
+namespace ktt
+{
+
+/** @class KernelCacheStatistics
+  * Class which holds usage statistics of kernel cache, which can be used to choose suitable cache capacity. See
+  * Tuner::setKernelCacheCapacity() for more information.
+  */
+class KTT_API KernelCacheStatistics
+{
+public:
+    /** @fn KernelCacheStatistics()
+      * Default constructor, creates statistics of unused cache.
+      */
+    KernelCacheStatistics();
+
+    /** @fn explicit KernelCacheStatistics(const uint64_t hitCount, const uint64_t missCount, const uint64_t evictionCount, const size_t size,
+      * const size_t capacity)
+      * Constructor which creates statistics with specified values.
+      * @param hitCount Number of kernel launches which found compiled kernel inside the cache.
+      * @param missCount Number of kernel launches which had to compile the kernel.
+      * @param evictionCount Number of kernels which were removed from the cache in order to make space for other kernels.
+      * @param size Number of kernels which are currently inside the cache.
+      * @param capacity Maximum number of kernels inside the cache.
+      */
+    explicit KernelCacheStatistics(const uint64_t hitCount, const uint64_t missCount, const uint64_t evictionCount, const size_t size,
+        const size_t capacity);
+
+    /** @fn uint64_t getHitCount() const
+      * Returns number of kernel launches which found compiled kernel inside the cache.
+      * @return Number of cache hits.
+      */
+    uint64_t getHitCount() const;
+
+    /** @fn uint64_t getMissCount() const
+      * Returns number of kernel launches which had to compile the kernel, including the ones which retrieved program compiled in background.
+      * @return Number of cache misses.
+      */
+    uint64_t getMissCount() const;
+
+    /** @fn uint64_t getEvictionCount() const
+      * Returns number of kernels which were removed from the cache in order to make space for other kernels. High number of evictions
+      * compared to number of misses indicates that cache capacity is too low.
+      * @return Number of cache evictions.
+      */
+    uint64_t getEvictionCount() const;
+
+    /** @fn size_t getSize() const
+      * Returns number of kernels which are currently inside the cache.
+      * @return Number of cached kernels.
+      */
+    size_t getSize() const;
+
+    /** @fn size_t getCapacity() const
+      * Returns maximum number of kernels inside the cache.
+      * @return Cache capacity.
+      */
+    size_t getCapacity() const;
+
+    /** @fn double getHitRate() const
+      * Returns fraction of kernel launches which found compiled kernel inside the cache.
+      * @return Cache hit rate between zero and one. If the cache was not used yet, zero.
+      */
+    double getHitRate() const;
+
+private:
+    uint64_t hitCount;
+    uint64_t missCount;
+    uint64_t evictionCount;
+    size_t size;
+    size_t capacity;
+};
+
+} // namespace ktt
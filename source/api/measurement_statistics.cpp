@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <api/measurement_statistics.h>
+
+namespace ktt
+{
+
+MeasurementStatistics::MeasurementStatistics()
+{}
+
+MeasurementStatistics::MeasurementStatistics(const std::vector<uint64_t>& durations) :
+    durations(durations),
+    sortedDurations(durations)
+{
+    std::sort(sortedDurations.begin(), sortedDurations.end());
+}
+
+size_t MeasurementStatistics::getMeasurementCount() const
+{
+    return durations.size();
+}
+
+const std::vector<uint64_t>& MeasurementStatistics::getDurations() const
+{
+    return durations;
+}
+
+uint64_t MeasurementStatistics::getMinimum() const
+{
+    if (sortedDurations.empty())
+    {
+        return 0;
+    }
+
+    return sortedDurations.front();
+}
+
+uint64_t MeasurementStatistics::getMaximum() const
+{
+    if (sortedDurations.empty())
+    {
+        return 0;
+    }
+
+    return sortedDurations.back();
+}
+
+double MeasurementStatistics::getMean() const
+{
+    if (durations.empty())
+    {
+        return 0.0;
+    }
+
+    double sum = 0.0;
+    for (const auto duration : durations)
+    {
+        sum += static_cast<double>(duration);
+    }
+
+    return sum / static_cast<double>(durations.size());
+}
+
+double MeasurementStatistics::getMedian() const
+{
+    return getPercentile(50.0);
+}
+
+double MeasurementStatistics::getStandardDeviation() const
+{
+    if (durations.size() < 2)
+    {
+        return 0.0;
+    }
+
+    const double mean = getMean();
+    double sum = 0.0;
+
+    for (const auto duration : durations)
+    {
+        const double difference = static_cast<double>(duration) - mean;
+        sum += difference * difference;
+    }
+
+    return std::sqrt(sum / static_cast<double>(durations.size() - 1));
+}
+
+double MeasurementStatistics::getConfidenceIntervalHalfWidth() const
+{
+    // One-sided 97.5% quantiles of Student's t-distribution for 1 to 30 degrees of freedom, used for two-sided 95% confidence interval
+    static const double tQuantiles[] =
+    {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+    };
+
+    if (durations.size() < 2)
+    {
+        return 0.0;
+    }
+
+    const size_t degreesOfFreedom = durations.size() - 1;
+    const double quantile = degreesOfFreedom <= 30 ? tQuantiles[degreesOfFreedom - 1] : 1.960;
+    return quantile * getStandardDeviation() / std::sqrt(static_cast<double>(durations.size()));
+}
+
+double MeasurementStatistics::getPercentile(const double percentile) const
+{
+    if (percentile < 0.0 || percentile > 100.0)
+    {
+        throw std::runtime_error(std::string("Percentile must be within range 0.0 to 100.0: ") + std::to_string(percentile));
+    }
+
+    if (sortedDurations.empty())
+    {
+        return 0.0;
+    }
+
+    const double position = percentile / 100.0 * static_cast<double>(sortedDurations.size() - 1);
+    const size_t lowerIndex = static_cast<size_t>(std::floor(position));
+    const size_t upperIndex = std::min(lowerIndex + 1, sortedDurations.size() - 1);
+    const double fraction = position - static_cast<double>(lowerIndex);
+
+    return static_cast<double>(sortedDurations[lowerIndex])
+        + fraction * (static_cast<double>(sortedDurations[upperIndex]) - static_cast<double>(sortedDurations[lowerIndex]));
+}
+
+uint64_t MeasurementStatistics::getStatistic(const MeasurementStatistic statistic) const
+{
+    switch (statistic)
+    {
+    case MeasurementStatistic::Minimum:
+        return getMinimum();
+    case MeasurementStatistic::Median:
+        return static_cast<uint64_t>(std::llround(getMedian()));
+    case MeasurementStatistic::Mean:
+        return static_cast<uint64_t>(std::llround(getMean()));
+    case MeasurementStatistic::Maximum:
+        return getMaximum();
+    default:
+        throw std::runtime_error("Unknown measurement statistic");
+    }
+}
+
+} // namespace ktt
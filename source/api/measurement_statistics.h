@@ -0,0 +1,100 @@
+/** @file measurement_statistics.h
+  * Statistics of repeated measurements of specific kernel configuration.
+  */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <enum/measurement_statistic.h>
+#include <ktt_platform.h>
+
+namespace ktt
+{
+
+/** @class MeasurementStatistics
+  * Class which holds durations of repeated measurements of specific kernel configuration and provides their statistics. All durations are in
+  * nanoseconds.
+  */
+class KTT_API MeasurementStatistics
+{
+public:
+    /** @fn MeasurementStatistics()
+      * Default constructor, creates statistics without any measurements.
+      */
+    MeasurementStatistics();
+
+    /** @fn explicit MeasurementStatistics(const std::vector<uint64_t>& durations)
+      * Constructor which creates statistics from provided durations.
+      * @param durations Durations of individual measurements in nanoseconds.
+      */
+    explicit MeasurementStatistics(const std::vector<uint64_t>& durations);
+
+    /** @fn size_t getMeasurementCount() const
+      * Returns number of measurements.
+      * @return Number of measurements.
+      */
+    size_t getMeasurementCount() const;
+
+    /** @fn const std::vector<uint64_t>& getDurations() const
+      * Returns durations of individual measurements in the order in which they were performed.
+      * @return Durations of individual measurements.
+      */
+    const std::vector<uint64_t>& getDurations() const;
+
+    /** @fn uint64_t getMinimum() const
+      * Returns the shortest measured duration.
+      * @return The shortest measured duration. If there are no measurements, zero.
+      */
+    uint64_t getMinimum() const;
+
+    /** @fn uint64_t getMaximum() const
+      * Returns the longest measured duration.
+      * @return The longest measured duration. If there are no measurements, zero.
+      */
+    uint64_t getMaximum() const;
+
+    /** @fn double getMean() const
+      * Returns arithmetic mean of measured durations.
+      * @return Arithmetic mean of measured durations. If there are no measurements, zero.
+      */
+    double getMean() const;
+
+    /** @fn double getMedian() const
+      * Returns median of measured durations.
+      * @return Median of measured durations. If there are no measurements, zero.
+      */
+    double getMedian() const;
+
+    /** @fn double getStandardDeviation() const
+      * Returns sample standard deviation of measured durations.
+      * @return Sample standard deviation of measured durations. If there are less than two measurements, zero.
+      */
+    double getStandardDeviation() const;
+
+    /** @fn double getConfidenceIntervalHalfWidth() const
+      * Returns half-width of 95% confidence interval of mean of measured durations, based on Student's t-distribution.
+      * @return Half-width of 95% confidence interval of mean. If there are less than two measurements, zero.
+      */
+    double getConfidenceIntervalHalfWidth() const;
+
+    /** @fn double getPercentile(const double percentile) const
+      * Returns specified percentile of measured durations. Values between measured durations are linearly interpolated.
+      * @param percentile Percentile which will be returned, must be within range 0.0 to 100.0.
+      * @return Specified percentile of measured durations. If there are no measurements, zero.
+      */
+    double getPercentile(const double percentile) const;
+
+    /** @fn uint64_t getStatistic(const MeasurementStatistic statistic) const
+      * Returns value of specified statistic rounded to nanoseconds.
+      * @param statistic Statistic which will be returned. See ::MeasurementStatistic for more information.
+      * @return Value of specified statistic. If there are no measurements, zero.
+      */
+    uint64_t getStatistic(const MeasurementStatistic statistic) const;
+
+private:
+    std::vector<uint64_t> durations;
+    std::vector<uint64_t> sortedDurations;
+};
+
+} // namespace ktt
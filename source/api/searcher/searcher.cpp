@@ -0,0 +1,83 @@
+#include <stdexcept>
+#include <string>
+#include <api/searcher/searcher.h>
+#include <kernel/kernel_configuration.h>
+
+namespace ktt
+{
+
+Searcher::Searcher() :
+    configurations(nullptr)
+{}
+
+Searcher::~Searcher() = default;
+
+void Searcher::onInitialize()
+{}
+
+void Searcher::onReset()
+{}
+
+std::vector<size_t> Searcher::getUpcomingConfigurationIndices(const size_t) const
+{
+    return std::vector<size_t>{};
+}
+
+std::vector<size_t> Searcher::getLikelyConfigurationIndices(const size_t) const
+{
+    return std::vector<size_t>{};
+}
+
+size_t Searcher::getConfigurationCount() const
+{
+    if (configurations == nullptr)
+    {
+        return 0;
+    }
+
+    return configurations->size();
+}
+
+const std::vector<ParameterPair>& Searcher::getConfiguration(const size_t index) const
+{
+    if (configurations == nullptr)
+    {
+        throw std::runtime_error("Searcher is not attached to any configuration space");
+    }
+
+    if (index >= configurations->size())
+    {
+        throw std::runtime_error(std::string("Configuration index is out of range: ") + std::to_string(index));
+    }
+
+    return configurations->at(index).getParameterPairs();
+}
+
+bool Searcher::isInitialized() const
+{
+    return configurations != nullptr;
+}
+
+void Searcher::initialize(const std::vector<KernelConfiguration>& configurations)
+{
+    if (configurations.empty())
+    {
+        throw std::runtime_error("Configurations vector provided for searcher is empty");
+    }
+
+    this->configurations = &configurations;
+    onInitialize();
+}
+
+void Searcher::reset()
+{
+    if (configurations == nullptr)
+    {
+        return;
+    }
+
+    onReset();
+    configurations = nullptr;
+}
+
+} // namespace ktt
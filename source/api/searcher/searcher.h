@@ -0,0 +1,121 @@
+/** @file searcher.h
+  * Interface for implementing kernel configuration searchers.
+  */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <api/computation_result.h>
+#include <api/parameter_pair.h>
+#include <ktt_platform.h>
+
+namespace ktt
+{
+
+class KernelConfiguration;
+
+/** @class Searcher
+  * Class which decides the order in which kernel configurations are explored during tuning. In order to use custom searcher, new class which
+  * publicly inherits from searcher class has to be defined and passed to the tuner through Tuner::setSearcher() method. Searcher refers to
+  * configurations by their index inside configuration space. Configuration space is read-only and can be accessed from inheriting class through
+  * getConfigurationCount() and getConfiguration() methods.
+  */
+class KTT_API Searcher
+{
+public:
+    /** @fn Searcher()
+      * Default constructor, creates searcher which is not yet attached to any configuration space.
+      */
+    Searcher();
+
+    /** @fn virtual ~Searcher()
+      * Searcher destructor. Inheriting class can override destructor with custom implementation. Default implementation is provided by KTT
+      * framework.
+      */
+    virtual ~Searcher();
+
+    /** @fn virtual void onInitialize()
+      * Called after searcher is attached to configuration space, right before the first configuration is requested. Searcher can be attached
+      * multiple times, eg. once for each parameter pack of tuned kernel. Inheriting class can override this method in order to initialize its
+      * internal state. Default implementation does nothing.
+      */
+    virtual void onInitialize();
+
+    /** @fn virtual void onReset()
+      * Called right before searcher is detached from configuration space. Inheriting class can override this method in order to clear its
+      * internal state. Default implementation does nothing.
+      */
+    virtual void onReset();
+
+    /** @fn virtual void calculateNextConfiguration(const ComputationResult& previousResult) = 0
+      * Decides which configuration will be explored next. Called after each tested configuration. Inheriting class must provide implementation
+      * for this method.
+      * @param previousResult Computation result from last tested configuration. It contains measured duration, compilation data and profiling
+      * counters (if kernel profiling is enabled). Searcher should minimize objective value of the results, which is equal to measured duration
+      * unless tuning objectives were added. See ComputationResult for more information.
+      */
+    virtual void calculateNextConfiguration(const ComputationResult& previousResult) = 0;
+
+    /** @fn virtual size_t getNextConfigurationIndex() const = 0
+      * Returns index of configuration which will be explored next. Inheriting class must provide implementation for this method.
+      * @return Index of configuration which will be explored next. Index must be lower than number returned by getConfigurationCount() method.
+      */
+    virtual size_t getNextConfigurationIndex() const = 0;
+
+    /** @fn virtual size_t getUnexploredConfigurationCount() const = 0
+      * Returns number of configurations which were not explored yet. Tuning of current configuration space ends once this method returns zero.
+      * Inheriting class must provide implementation for this method.
+      * @return Number of configurations which were not explored yet.
+      */
+    virtual size_t getUnexploredConfigurationCount() const = 0;
+
+    /** @fn virtual std::vector<size_t> getUpcomingConfigurationIndices(const size_t count) const
+      * Returns indices of configurations which will be explored after the next configuration, regardless of results of the configurations
+      * which are currently being tested. KTT framework uses these indices to compile upcoming configurations in background while the current
+      * configuration is running. See Tuner::setCompilationLookahead() for more information. Inheriting class can override this method if the
+      * order of explored configurations is known in advance. Default implementation returns empty vector.
+      * @param count Maximum number of returned indices.
+      * @return Indices of configurations which will be explored after the next configuration, in the order of their exploration.
+      */
+    virtual std::vector<size_t> getUpcomingConfigurationIndices(const size_t count) const;
+
+    /** @fn virtual std::vector<size_t> getLikelyConfigurationIndices(const size_t count) const
+      * Returns indices of configurations which are likely to be explored after the next configuration. Unlike upcoming configurations, the
+      * choice may depend on result of the configuration which is currently being tested, eg. neighbours of current state for local searchers.
+      * KTT framework compiles these configurations speculatively on idle compilation threads and discards them if they are not used. See
+      * Tuner::setSpeculativeCompilation() for more information. Inheriting class can override this method in order to hide compilation
+      * latency of inherently sequential search. Default implementation returns empty vector.
+      * @param count Maximum number of returned indices.
+      * @return Indices of configurations which are likely to be explored after the next configuration, ranked from the most likely one.
+      */
+    virtual std::vector<size_t> getLikelyConfigurationIndices(const size_t count) const;
+
+    /** @fn size_t getConfigurationCount() const
+      * Returns number of configurations inside configuration space the searcher is currently attached to.
+      * @return Number of configurations inside configuration space. If searcher is not attached, returns zero.
+      */
+    size_t getConfigurationCount() const;
+
+    /** @fn const std::vector<ParameterPair>& getConfiguration(const size_t index) const
+      * Returns parameter values of configuration with specified index. Throws an exception if searcher is not attached or index is out of range.
+      * @param index Index of configuration inside configuration space.
+      * @return Parameter values of configuration with specified index. See ParameterPair for more information.
+      */
+    const std::vector<ParameterPair>& getConfiguration(const size_t index) const;
+
+    /** @fn bool isInitialized() const
+      * Checks whether searcher is currently attached to configuration space.
+      * @return True if searcher is attached to configuration space, false otherwise.
+      */
+    bool isInitialized() const;
+
+    friend class ConfigurationManager;
+
+private:
+    const std::vector<KernelConfiguration>* configurations;
+
+    void initialize(const std::vector<KernelConfiguration>& configurations);
+    void reset();
+};
+
+} // namespace ktt
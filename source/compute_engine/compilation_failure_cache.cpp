@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+#include <compute_engine/compilation_failure_cache.h>
+
+namespace ktt
+{
+
+const size_t maximumCauseLength = 200;
+
+CompilationFailureCache::CompilationFailureCache(ProgramBinaryCache& persistentCache) :
+    persistentCache(persistentCache)
+{}
+
+bool CompilationFailureCache::find(const std::string& key, std::string& message)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto failurePointer = failures.find(key);
+
+        if (failurePointer != failures.end())
+        {
+            message = failurePointer->second;
+            failureCauses[getFailureCause(message)]++;
+            return true;
+        }
+    }
+
+    // Persistent cache has its own lock and performs file operations, so it is accessed without holding the lock
+    if (!persistentCache.isEnabled() || !persistentCache.load(getPersistentKey(key), message))
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    failures[key] = message;
+    failureCauses[getFailureCause(message)]++;
+    return true;
+}
+
+void CompilationFailureCache::insert(const std::string& key, const std::string& message, const bool compilerDiagnostic)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        failures[key] = message;
+        failureCauses[getFailureCause(message)]++;
+    }
+
+    if (compilerDiagnostic && persistentCache.isEnabled())
+    {
+        persistentCache.store(getPersistentKey(key), message);
+    }
+}
+
+void CompilationFailureCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    failures.clear();
+    failureCauses.clear();
+}
+
+std::map<std::string, uint64_t> CompilationFailureCache::getFailureCauses() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return failureCauses;
+}
+
+std::string CompilationFailureCache::getFailureCause(const std::string& message)
+{
+    // Compute API errors contain build log after error code, the log is more descriptive if present
+    const std::string infoPrefix = "Additional info: ";
+    const size_t infoPosition = message.find(infoPrefix);
+    std::istringstream stream(infoPosition == std::string::npos ? message : message.substr(infoPosition + infoPrefix.size()));
+    std::string line;
+    std::string cause;
+
+    // Compiler diagnostics usually contain location prefix followed by "error: <description>"
+    while (std::getline(stream, line))
+    {
+        std::string lowercaseLine = line;
+        std::transform(lowercaseLine.begin(), lowercaseLine.end(), lowercaseLine.begin(),
+            [](const unsigned char symbol) { return static_cast<char>(std::tolower(symbol)); });
+        const size_t errorPosition = lowercaseLine.rfind("error:");
+
+        if (errorPosition != std::string::npos)
+        {
+            cause = line.substr(errorPosition);
+            break;
+        }
+
+        if (cause.empty() && line.find_first_not_of(" \t\r") != std::string::npos)
+        {
+            cause = line;
+        }
+    }
+
+    if (cause.empty())
+    {
+        cause = message.substr(0, message.find('\n'));
+    }
+
+    cause.erase(cause.find_last_not_of(" \t\r") + 1);
+
+    if (cause.size() > maximumCauseLength)
+    {
+        cause.resize(maximumCauseLength);
+    }
+
+    return cause.empty() ? std::string("Unknown compilation error") : cause;
+}
+
+std::string CompilationFailureCache::getPersistentKey(const std::string& key)
+{
+    return std::string("Compilation failure\n") + key;
+}
+
+} // namespace ktt
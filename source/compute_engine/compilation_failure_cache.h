@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <compute_engine/program_binary_cache.h>
+
+namespace ktt
+{
+
+// Remembers programs which failed to compile, so that configurations with the same effective source are rejected without compilation.
+// Failures reported by compiler diagnostics are optionally persisted inside program binary cache, other failures (eg. lack of resources) are
+// only remembered for the current run. Methods are thread-safe, so that the cache can be used by background compilation threads.
+class CompilationFailureCache
+{
+public:
+    explicit CompilationFailureCache(ProgramBinaryCache& persistentCache);
+
+    bool find(const std::string& key, std::string& message);
+    void insert(const std::string& key, const std::string& message, const bool compilerDiagnostic);
+    void clear();
+    std::map<std::string, uint64_t> getFailureCauses() const;
+
+    static std::string getFailureCause(const std::string& message);
+
+private:
+    ProgramBinaryCache& persistentCache;
+    // Keyed by the whole key, so that programs with colliding digests are never mistaken for each other
+    std::map<std::string, std::string> failures;
+    std::map<std::string, uint64_t> failureCauses;
+    mutable std::mutex mutex;
+
+    static std::string getPersistentKey(const std::string& key);
+};
+
+} // namespace ktt
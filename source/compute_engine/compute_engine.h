@@ -1,9 +1,12 @@
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <ostream>
 #include <string>
 #include <vector>
 #include <api/device_info.h>
+#include <api/kernel_cache_statistics.h>
 #include <api/output_descriptor.h>
 #include <api/platform_info.h>
 #include <dto/kernel_result.h>
@@ -27,14 +30,21 @@ public:
     virtual EventId runKernelAsync(const KernelRuntimeData& kernelData, const std::vector<KernelArgument*>& argumentPointers, const QueueId queue) = 0;
     virtual KernelResult getKernelResult(const EventId id, const std::vector<OutputDescriptor>& outputDescriptors) const = 0;
     virtual uint64_t getKernelOverhead(const EventId id) const = 0;
+    virtual void precompileKernel(const KernelRuntimeData& kernelData, const bool speculative) = 0;
 
     // Utility methods
     virtual void setCompilerOptions(const std::string& options) = 0;
+    virtual void setSpecializationConstantUsage(const bool flag) = 0;
     virtual void setGlobalSizeType(const GlobalSizeType type) = 0;
     virtual void setAutomaticGlobalSizeCorrection(const bool flag) = 0;
     virtual void setKernelCacheUsage(const bool flag) = 0;
     virtual void setKernelCacheCapacity(const size_t capacity) = 0;
     virtual void clearKernelCache() = 0;
+    virtual KernelCacheStatistics getKernelCacheStatistics() const = 0;
+    virtual void setPersistentKernelCache(const std::string& directory, const size_t maximumSize) = 0;
+    virtual std::map<std::string, uint64_t> getCompilationFailureCauses() const = 0;
+    virtual void setCompilationThreadCount(const size_t count) = 0;
+    virtual void setSpeculativeCacheCapacity(const size_t capacity) = 0;
 
     // Queue handling methods
     virtual QueueId getDefaultQueue() const = 0;
@@ -55,8 +65,11 @@ public:
     virtual EventId copyArgumentAsync(const ArgumentId destination, const ArgumentId source, const size_t dataSizeInBytes, const QueueId queue) = 0;
     virtual uint64_t persistArgument(KernelArgument& kernelArgument, const bool flag) = 0;
     virtual uint64_t getArgumentOperationDuration(const EventId id) const = 0;
+    virtual size_t getArgumentBufferSize(const ArgumentId id) const = 0;
     virtual void resizeArgument(const ArgumentId id, const size_t newSize, const bool preserveData) = 0;
     virtual void setPersistentBufferUsage(const bool flag) = 0;
+    virtual void setArgumentSnapshotUsage(const bool flag) = 0;
+    virtual void setPinnedStagingUsage(const bool flag) = 0;
     virtual void clearBuffer(const ArgumentId id) = 0;
     virtual void clearBuffers() = 0;
     virtual void clearBuffers(const ArgumentAccessType accessType) = 0;
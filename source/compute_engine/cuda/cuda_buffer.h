@@ -6,6 +6,7 @@
 #include <vector>
 #include <cuda.h>
 #include <compute_engine/cuda/cuda_utility.h>
+#include <compute_engine/device_memory_pool.h>
 #include <enum/argument_access_type.h>
 #include <enum/argument_data_type.h>
 #include <enum/argument_memory_location.h>
@@ -18,6 +19,11 @@ class CUDABuffer
 {
 public:
     explicit CUDABuffer(KernelArgument& kernelArgument, const bool zeroCopy) :
+        CUDABuffer(kernelArgument, zeroCopy, nullptr)
+    {}
+
+    // Device buffers using memory pool take their allocations from it and return them there once they are released
+    explicit CUDABuffer(KernelArgument& kernelArgument, const bool zeroCopy, DeviceMemoryPool<CUdeviceptr>* memoryPool) :
         kernelArgumentId(kernelArgument.getId()),
         bufferSize(kernelArgument.getDataSizeInBytes()),
         elementSize(kernelArgument.getElementSizeInBytes()),
@@ -25,11 +31,12 @@ public:
         memoryLocation(kernelArgument.getMemoryLocation()),
         accessType(kernelArgument.getAccessType()),
         hostBufferRaw(nullptr),
-        zeroCopy(zeroCopy)
+        zeroCopy(zeroCopy),
+        memoryPool(memoryLocation == ArgumentMemoryLocation::Device ? memoryPool : nullptr)
     {
         if (memoryLocation == ArgumentMemoryLocation::Device)
         {
-            checkCUDAError(cuMemAlloc(&deviceBuffer, bufferSize), "cuMemAlloc");
+            deviceBuffer = allocateDeviceBuffer(bufferSize, allocationSize);
         }
         else
         {
@@ -50,7 +57,7 @@ public:
     {
         if (memoryLocation == ArgumentMemoryLocation::Device)
         {
-            checkCUDAError(cuMemFree(deviceBuffer), "cuMemFree");
+            releaseDeviceBuffer(deviceBuffer, allocationSize);
         }
         else
         {
@@ -81,8 +88,8 @@ public:
         {
             if (memoryLocation == ArgumentMemoryLocation::Device)
             {
-                checkCUDAError(cuMemFree(deviceBuffer), "cuMemFree");
-                checkCUDAError(cuMemAlloc(&deviceBuffer, newBufferSize), "cuMemAlloc");
+                releaseDeviceBuffer(deviceBuffer, allocationSize);
+                deviceBuffer = allocateDeviceBuffer(newBufferSize, allocationSize);
             }
             else
             {
@@ -95,11 +102,12 @@ public:
         {
             if (memoryLocation == ArgumentMemoryLocation::Device)
             {
-                CUdeviceptr newDeviceBuffer;
-                checkCUDAError(cuMemAlloc(&newDeviceBuffer, newBufferSize), "cuMemAlloc");
+                size_t newAllocationSize;
+                CUdeviceptr newDeviceBuffer = allocateDeviceBuffer(newBufferSize, newAllocationSize);
                 checkCUDAError(cuMemcpyDtoD(newDeviceBuffer, deviceBuffer, std::min(bufferSize, newBufferSize)), "cuMemcpyDtoD");
-                checkCUDAError(cuMemFree(deviceBuffer), "cuMemFree");
+                releaseDeviceBuffer(deviceBuffer, allocationSize);
                 deviceBuffer = newDeviceBuffer;
+                allocationSize = newAllocationSize;
             }
             else
             {
@@ -273,6 +281,38 @@ private:
     CUdeviceptr hostBuffer;
     void* hostBufferRaw;
     bool zeroCopy;
+    DeviceMemoryPool<CUdeviceptr>* memoryPool;
+    size_t allocationSize;
+
+    CUdeviceptr allocateDeviceBuffer(const size_t size, size_t& allocatedSize)
+    {
+        CUdeviceptr newBuffer;
+        allocatedSize = size;
+
+        if (memoryPool != nullptr)
+        {
+            allocatedSize = DeviceMemoryPool<CUdeviceptr>::getSizeClass(size);
+
+            if (memoryPool->acquire(0, allocatedSize, newBuffer))
+            {
+                return newBuffer;
+            }
+        }
+
+        checkCUDAError(cuMemAlloc(&newBuffer, allocatedSize), "cuMemAlloc");
+        return newBuffer;
+    }
+
+    void releaseDeviceBuffer(CUdeviceptr releasedBuffer, const size_t allocatedSize)
+    {
+        if (memoryPool != nullptr)
+        {
+            memoryPool->release(0, allocatedSize, releasedBuffer);
+            return;
+        }
+
+        checkCUDAError(cuMemFree(releasedBuffer), "cuMemFree");
+    }
 };
 
 } // namespace ktt
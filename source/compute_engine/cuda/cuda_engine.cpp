@@ -1,5 +1,7 @@
 #ifdef KTT_PLATFORM_CUDA
 
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 #include <compute_engine/cuda/cuda_engine.h>
 #include <utility/ktt_utility.h>
@@ -21,9 +23,16 @@ CUDAEngine::CUDAEngine(const DeviceIndex deviceIndex, const uint32_t queueCount)
     globalSizeType(GlobalSizeType::CUDA),
     globalSizeCorrection(false),
     kernelCacheFlag(true),
-    kernelCacheCapacity(10),
+    speculativeCacheCapacity(0),
     persistentBufferFlag(true),
-    nextEventId(0)
+    argumentSnapshotFlag(false),
+    pinnedStagingFlag(false),
+    nextEventId(0),
+    bufferPool(0, [](CUdeviceptr buffer) { checkCUDAError(cuMemFree(buffer), "cuMemFree"); }),
+    kernelCache(10),
+    failureCache(binaryCache),
+    stagingPool(0, [](CUDAStagingBuffer staging) { checkCUDAError(cuMemFreeHost(staging.data), "cuMemFreeHost"); }),
+    compilationPool(ThreadPool::getHardwareThreadCount())
 {
     Logger::logDebug("Initializing CUDA runtime");
     checkCUDAError(cuInit(0), "cuInit");
@@ -37,6 +46,21 @@ CUDAEngine::CUDAEngine(const DeviceIndex deviceIndex, const uint32_t queueCount)
     Logger::logDebug("Initializing CUDA context");
     context = std::make_unique<CUDAContext>(devices.at(deviceIndex).getDevice());
 
+    // PTX is generated by NVRTC and can only be reused with the same compiler version, device and driver
+    int driverVersion;
+    checkCUDAError(cuDriverGetVersion(&driverVersion), "cuDriverGetVersion");
+    int nvrtcMajor;
+    int nvrtcMinor;
+    checkCUDAError(nvrtcVersion(&nvrtcMajor, &nvrtcMinor), "nvrtcVersion");
+    binaryCacheIdentity = devices.at(deviceIndex).getName() + "\n" + std::to_string(driverVersion) + "\n" + std::to_string(nvrtcMajor) + "."
+        + std::to_string(nvrtcMinor) + "\n";
+
+    // Allocations released between kernel configurations are kept for reuse up to a quarter of device memory
+    size_t globalMemory;
+    checkCUDAError(cuDeviceTotalMem(&globalMemory, devices.at(deviceIndex).getDevice()), "cuDeviceTotalMem");
+    bufferPool.setCapacity(globalMemory / 4);
+    stagingPool.setCapacity(globalMemory / 4);
+
     Logger::logDebug("Initializing CUDA streams");
     for (uint32_t i = 0; i < queueCount; i++)
     {
@@ -75,23 +99,11 @@ EventId CUDAEngine::runKernelAsync(const KernelRuntimeData& kernelData, const st
 
     if (kernelCacheFlag)
     {
-        if (kernelCache.find(std::make_pair(kernelData.getName(), kernelData.getSource())) == kernelCache.end())
-        {
-            if (kernelCache.size() >= kernelCacheCapacity)
-            {
-                clearKernelCache();
-            }
-            std::unique_ptr<CUDAProgram> program = createAndBuildProgram(kernelData.getSource());
-            auto kernel = std::make_unique<CUDAKernel>(program->getPtxSource(), kernelData.getName());
-            kernelCache.insert(std::make_pair(std::make_pair(kernelData.getName(), kernelData.getSource()), std::move(kernel)));
-        }
-        auto cachePointer = kernelCache.find(std::make_pair(kernelData.getName(), kernelData.getSource()));
-        kernel = cachePointer->second.get();
+        kernel = loadKernelFromCache(kernelData);
     }
     else
     {
-        std::unique_ptr<CUDAProgram> program = createAndBuildProgram(kernelData.getSource());
-        kernelUnique = std::make_unique<CUDAKernel>(program->getPtxSource(), kernelData.getName());
+        kernelUnique = std::make_unique<CUDAKernel>(createAndBuildProgram(kernelData), kernelData.getName());
         kernel = kernelUnique.get();
     }
 
@@ -128,11 +140,58 @@ uint64_t CUDAEngine::getKernelOverhead(const EventId id) const
     return eventPointer->second.first->getOverhead();
 }
 
+void CUDAEngine::precompileKernel(const KernelRuntimeData& kernelData, const bool speculative)
+{
+    const auto key = std::make_pair(kernelData.getProgramName(), kernelData.getSource());
+
+    if (!kernelCacheFlag || kernelCache.contains(kernelData.getProgramName(), kernelData.getSource()))
+    {
+        return;
+    }
+
+    if (pendingPrograms.find(key) != pendingPrograms.end())
+    {
+        if (!speculative)
+        {
+            // Program is going to be used for sure, so it is no longer subject to speculative cache capacity
+            speculativePrograms.erase(std::remove(speculativePrograms.begin(), speculativePrograms.end(), key), speculativePrograms.end());
+        }
+        return;
+    }
+
+    if (speculative && speculativeCacheCapacity == 0)
+    {
+        return;
+    }
+
+    // Only NVRTC compilation is performed in background, module has to be loaded by thread which owns CUDA context
+    pendingPrograms.insert(std::make_pair(key, createAndBuildProgramAsync(kernelData, speculative)));
+
+    if (speculative)
+    {
+        speculativePrograms.push_back(key);
+
+        if (speculativePrograms.size() > speculativeCacheCapacity)
+        {
+            pendingPrograms.erase(speculativePrograms.front());
+            speculativePrograms.pop_front();
+        }
+    }
+}
+
 void CUDAEngine::setCompilerOptions(const std::string& options)
 {
     compilerOptions = options;
 }
 
+void CUDAEngine::setSpecializationConstantUsage(const bool flag)
+{
+    if (flag)
+    {
+        throw std::runtime_error("Specialization constants are not supported for CUDA backend");
+    }
+}
+
 void CUDAEngine::setGlobalSizeType(const GlobalSizeType type)
 {
     globalSizeType = type;
@@ -154,12 +213,46 @@ void CUDAEngine::setKernelCacheUsage(const bool flag)
 
 void CUDAEngine::setKernelCacheCapacity(const size_t capacity)
 {
-    kernelCacheCapacity = capacity;
+    kernelCache.setCapacity(capacity);
 }
 
 void CUDAEngine::clearKernelCache()
 {
     kernelCache.clear();
+    pendingPrograms.clear();
+    speculativePrograms.clear();
+}
+
+KernelCacheStatistics CUDAEngine::getKernelCacheStatistics() const
+{
+    return kernelCache.getStatistics();
+}
+
+void CUDAEngine::setPersistentKernelCache(const std::string& directory, const size_t maximumSize)
+{
+    binaryCache.setDirectory(directory, maximumSize);
+}
+
+std::map<std::string, uint64_t> CUDAEngine::getCompilationFailureCauses() const
+{
+    return failureCache.getFailureCauses();
+}
+
+void CUDAEngine::setCompilationThreadCount(const size_t count)
+{
+    compilationPool.setThreadCount(count);
+}
+
+void CUDAEngine::setSpeculativeCacheCapacity(const size_t capacity)
+{
+    speculativeCacheCapacity = capacity;
+    compilationPool.setLowPriorityTaskLimit(capacity);
+
+    while (speculativePrograms.size() > speculativeCacheCapacity)
+    {
+        pendingPrograms.erase(speculativePrograms.front());
+        speculativePrograms.pop_front();
+    }
 }
 
 QueueId CUDAEngine::getDefaultQueue() const
@@ -199,6 +292,20 @@ void CUDAEngine::synchronizeDevice()
 
 void CUDAEngine::clearEvents()
 {
+    // Staging buffers can only be reused once the transfers utilizing them are finished
+    for (auto& staging : stagingBuffers)
+    {
+        auto eventPointer = bufferEvents.find(staging.first);
+
+        if (eventPointer != bufferEvents.end())
+        {
+            checkCUDAError(cuEventSynchronize(eventPointer->second.second->getEvent()), "cuEventSynchronize");
+        }
+
+        stagingPool.release(0, staging.second.first.size, staging.second.first);
+    }
+
+    stagingBuffers.clear();
     kernelEvents.clear();
     bufferEvents.clear();
 
@@ -253,15 +360,34 @@ EventId CUDAEngine::uploadArgumentAsync(KernelArgument& kernelArgument, const Qu
     }
     else
     {
-        buffer = std::make_unique<CUDABuffer>(kernelArgument, false);
+        buffer = std::make_unique<CUDABuffer>(kernelArgument, false, &bufferPool);
         auto startEvent = std::make_unique<CUDAEvent>(eventId, true);
         auto endEvent = std::make_unique<CUDAEvent>(eventId, true);
-        buffer->uploadData(streams.at(queue)->getStream(), kernelArgument.getData(), kernelArgument.getDataSizeInBytes(), startEvent->getEvent(),
-            endEvent->getEvent());
+        const CUDABuffer* snapshot = findArgumentSnapshot(kernelArgument);
+
+        if (snapshot != nullptr)
+        {
+            buffer->uploadData(streams.at(queue)->getStream(), snapshot, kernelArgument.getDataSizeInBytes(), startEvent->getEvent(),
+                endEvent->getEvent());
+        }
+        else
+        {
+            const void* source = getUploadSource(eventId, *buffer, kernelArgument.getData(), kernelArgument.getDataSizeInBytes());
+            buffer->uploadData(streams.at(queue)->getStream(), source, kernelArgument.getDataSizeInBytes(), startEvent->getEvent(),
+                endEvent->getEvent());
+        }
+
         bufferEvents.insert(std::make_pair(eventId, std::make_pair(std::move(startEvent), std::move(endEvent))));
+
+        // Referenced host data can be modified by user without notice, so only arguments which own their data are snapshotted
+        if (snapshot == nullptr && argumentSnapshotFlag && kernelArgument.getAccessType() != ArgumentAccessType::ReadOnly
+            && kernelArgument.getMemoryLocation() == ArgumentMemoryLocation::Device && kernelArgument.hasOwnedData())
+        {
+            createArgumentSnapshot(kernelArgument, *buffer, queue);
+        }
     }
 
-    buffers.insert(std::move(buffer)); // buffer data will be stolen
+    buffers[kernelArgument.getId()] = std::move(buffer);
     nextEventId++;
     return eventId;
 }
@@ -292,14 +418,9 @@ EventId CUDAEngine::updateArgumentAsync(const ArgumentId id, const void* data, c
 
     Logger::getLogger().log(LoggingLevel::Debug, "Updating buffer for argument " + std::to_string(id) + ", event id: " + std::to_string(eventId));
 
-    if (dataSizeInBytes == 0)
-    {
-        buffer->uploadData(streams.at(queue)->getStream(), data, buffer->getBufferSize(), startEvent->getEvent(), endEvent->getEvent());
-    }
-    else
-    {
-        buffer->uploadData(streams.at(queue)->getStream(), data, dataSizeInBytes, startEvent->getEvent(), endEvent->getEvent());
-    }
+    const size_t uploadSize = dataSizeInBytes == 0 ? buffer->getBufferSize() : dataSizeInBytes;
+    const void* source = getUploadSource(eventId, *buffer, data, uploadSize);
+    buffer->uploadData(streams.at(queue)->getStream(), source, uploadSize, startEvent->getEvent(), endEvent->getEvent());
 
     bufferEvents.insert(std::make_pair(eventId, std::make_pair(std::move(startEvent), std::move(endEvent))));
     nextEventId++;
@@ -308,6 +429,14 @@ EventId CUDAEngine::updateArgumentAsync(const ArgumentId id, const void* data, c
 
 uint64_t CUDAEngine::downloadArgument(const ArgumentId id, void* destination, const size_t dataSizeInBytes) const
 {
+    const CUDABuffer* buffer = findBuffer(id);
+
+    // Asynchronous downloads are not staged, because data has to be copied from staging buffer after the transfer is finished
+    if (pinnedStagingFlag && buffer != nullptr && buffer->getMemoryLocation() == ArgumentMemoryLocation::Device)
+    {
+        return downloadThroughStagingBuffer(*buffer, destination, dataSizeInBytes == 0 ? buffer->getBufferSize() : dataSizeInBytes);
+    }
+
     EventId eventId = downloadArgumentAsync(id, destination, dataSizeInBytes, getDefaultQueue());
     return getArgumentOperationDuration(eventId);
 }
@@ -357,19 +486,8 @@ KernelArgument CUDAEngine::downloadArgumentObject(const ArgumentId id, uint64_t*
 
     KernelArgument argument(buffer->getKernelArgumentId(), buffer->getBufferSize() / buffer->getElementSize(), buffer->getElementSize(),
         buffer->getDataType(), buffer->getMemoryLocation(), buffer->getAccessType(), ArgumentUploadType::Vector);
-    
-    EventId eventId = nextEventId;
-    auto startEvent = std::make_unique<CUDAEvent>(eventId, true);
-    auto endEvent = std::make_unique<CUDAEvent>(eventId, true);
-
-    Logger::getLogger().log(LoggingLevel::Debug, "Downloading buffer for argument " + std::to_string(id) + ", event id: " + std::to_string(eventId));
-    buffer->downloadData(streams.at(getDefaultQueue())->getStream(), argument.getData(), argument.getDataSizeInBytes(), startEvent->getEvent(),
-        endEvent->getEvent());
 
-    bufferEvents.insert(std::make_pair(eventId, std::make_pair(std::move(startEvent), std::move(endEvent))));
-    nextEventId++;
-
-    uint64_t duration = getArgumentOperationDuration(eventId);
+    uint64_t duration = downloadArgument(id, argument.getData(), argument.getDataSizeInBytes());
     if (downloadDuration != nullptr)
     {
         *downloadDuration = duration;
@@ -429,26 +547,14 @@ EventId CUDAEngine::copyArgumentAsync(const ArgumentId destination, const Argume
 
 uint64_t CUDAEngine::persistArgument(KernelArgument& kernelArgument, const bool flag)
 {
-    bool bufferFound = false;
-    auto iterator = persistentBuffers.cbegin();
+    auto bufferPointer = persistentBuffers.find(kernelArgument.getId());
+    const bool bufferFound = bufferPointer != persistentBuffers.end();
 
-    while (iterator != persistentBuffers.cend())
+    if (!flag && bufferFound)
     {
-        if (iterator->get()->getKernelArgumentId() == kernelArgument.getId())
-        {
-            bufferFound = true;
-            if (!flag)
-            {
-                persistentBuffers.erase(iterator);
-            }
-            break;
-        }
-        else
-        {
-            ++iterator;
-        }
+        persistentBuffers.erase(bufferPointer);
     }
-    
+
     if (flag && !bufferFound)
     {
         std::unique_ptr<CUDABuffer> buffer = nullptr;
@@ -473,7 +579,7 @@ uint64_t CUDAEngine::persistArgument(KernelArgument& kernelArgument, const bool
             bufferEvents.insert(std::make_pair(eventId, std::make_pair(std::move(startEvent), std::move(endEvent))));
         }
 
-        persistentBuffers.insert(std::move(buffer)); // buffer data will be stolen
+        persistentBuffers[kernelArgument.getId()] = std::move(buffer);
         nextEventId++;
 
         return getArgumentOperationDuration(eventId);
@@ -505,7 +611,19 @@ uint64_t CUDAEngine::getArgumentOperationDuration(const EventId id) const
     float duration = getEventCommandDuration(eventPointer->second.first->getEvent(), eventPointer->second.second->getEvent());
     bufferEvents.erase(id);
 
-    return static_cast<uint64_t>(duration);
+    return static_cast<uint64_t>(duration) + releaseStagingBuffer(id);
+}
+
+size_t CUDAEngine::getArgumentBufferSize(const ArgumentId id) const
+{
+    CUDABuffer* buffer = findBuffer(id);
+
+    if (buffer == nullptr)
+    {
+        throw std::runtime_error(std::string("Buffer with following id was not found: ") + std::to_string(id));
+    }
+
+    return buffer->getBufferSize();
 }
 
 void CUDAEngine::resizeArgument(const ArgumentId id, const size_t newSize, const bool preserveData)
@@ -521,29 +639,36 @@ void CUDAEngine::resizeArgument(const ArgumentId id, const size_t newSize, const
     buffer->resize(newSize, preserveData);
 }
 
-void CUDAEngine::clearBuffer(const ArgumentId id)
+void CUDAEngine::setPinnedStagingUsage(const bool flag)
 {
-    auto iterator = buffers.cbegin();
+    pinnedStagingFlag = flag;
 
-    while (iterator != buffers.cend())
+    if (!flag)
     {
-        if (iterator->get()->getKernelArgumentId() == id)
-        {
-            buffers.erase(iterator);
-            return;
-        }
-        else
-        {
-            ++iterator;
-        }
+        stagingPool.clear();
     }
 }
 
+void CUDAEngine::clearBuffer(const ArgumentId id)
+{
+    buffers.erase(id);
+}
+
 void CUDAEngine::setPersistentBufferUsage(const bool flag)
 {
     persistentBufferFlag = flag;
 }
 
+void CUDAEngine::setArgumentSnapshotUsage(const bool flag)
+{
+    argumentSnapshotFlag = flag;
+
+    if (!flag)
+    {
+        argumentSnapshots.clear();
+    }
+}
+
 void CUDAEngine::clearBuffers()
 {
     buffers.clear();
@@ -555,7 +680,7 @@ void CUDAEngine::clearBuffers(const ArgumentAccessType accessType)
 
     while (iterator != buffers.cend())
     {
-        if (iterator->get()->getAccessType() == accessType)
+        if (iterator->second->getAccessType() == accessType)
         {
             iterator = buffers.erase(iterator);
         }
@@ -611,9 +736,9 @@ DeviceInfo CUDAEngine::getCurrentDeviceInfo() const
 void CUDAEngine::initializeKernelProfiling(const KernelRuntimeData& kernelData)
 {
     #ifdef KTT_PROFILING_CUPTI_LEGACY
-    initializeKernelProfiling(kernelData.getName(), kernelData.getSource());
+    initializeKernelProfiling(kernelData.getProgramName(), kernelData.getSource());
     #elif KTT_PROFILING_CUPTI
-    initializeKernelProfiling(kernelData.getName(), kernelData.getSource());
+    initializeKernelProfiling(kernelData.getProgramName(), kernelData.getSource());
     #else
     throw std::runtime_error("Support for kernel profiling is not included in this version of KTT framework");
     #endif // KTT_PROFILING_CUPTI_LEGACY
@@ -632,23 +757,11 @@ EventId CUDAEngine::runKernelWithProfiling(const KernelRuntimeData& kernelData,
 
     if (kernelCacheFlag)
     {
-        if (kernelCache.find(std::make_pair(kernelData.getName(), kernelData.getSource())) == kernelCache.end())
-        {
-            if (kernelCache.size() >= kernelCacheCapacity)
-            {
-                clearKernelCache();
-            }
-            std::unique_ptr<CUDAProgram> program = createAndBuildProgram(kernelData.getSource());
-            auto kernel = std::make_unique<CUDAKernel>(program->getPtxSource(), kernelData.getName());
-            kernelCache.insert(std::make_pair(std::make_pair(kernelData.getName(), kernelData.getSource()), std::move(kernel)));
-        }
-        auto cachePointer = kernelCache.find(std::make_pair(kernelData.getName(), kernelData.getSource()));
-        kernel = cachePointer->second.get();
+        kernel = loadKernelFromCache(kernelData);
     }
     else
     {
-        std::unique_ptr<CUDAProgram> program = createAndBuildProgram(kernelData.getSource());
-        kernelUnique = std::make_unique<CUDAKernel>(program->getPtxSource(), kernelData.getName());
+        kernelUnique = std::make_unique<CUDAKernel>(createAndBuildProgram(kernelData), kernelData.getName());
         kernel = kernelUnique.get();
     }
 
@@ -656,19 +769,19 @@ EventId CUDAEngine::runKernelWithProfiling(const KernelRuntimeData& kernelData,
 
     overheadTimer.stop();
 
-    if (kernelProfilingInstances.find(std::make_pair(kernelData.getName(), kernelData.getSource())) == kernelProfilingInstances.end())
+    if (kernelProfilingInstances.find(std::make_pair(kernelData.getProgramName(), kernelData.getSource())) == kernelProfilingInstances.end())
     {
-        initializeKernelProfiling(kernelData.getName(), kernelData.getSource());
+        initializeKernelProfiling(kernelData.getProgramName(), kernelData.getSource());
     }
 
-    auto profilingInstance = kernelProfilingInstances.find(std::make_pair(kernelData.getName(), kernelData.getSource()));
+    auto profilingInstance = kernelProfilingInstances.find(std::make_pair(kernelData.getProgramName(), kernelData.getSource()));
     EventId id;
 
     if (!profilingInstance->second->hasValidKernelDuration()) // The first profiling run only captures kernel duration
     {
         id = enqueueKernel(*kernel, kernelData.getGlobalSize(), kernelData.getLocalSize(), kernelArguments,
             getSharedMemorySizeInBytes(argumentPointers, kernelData.getLocalMemoryModifiers()), queue, overheadTimer.getElapsedTime());
-        kernelToEventMap[std::make_pair(kernelData.getName(), kernelData.getSource())].push_back(id);
+        kernelToEventMap[std::make_pair(kernelData.getProgramName(), kernelData.getSource())].push_back(id);
 
         Logger::logDebug("Performing kernel synchronization for event id: " + std::to_string(id));
         auto eventPointer = kernelEvents.find(id);
@@ -683,7 +796,7 @@ EventId CUDAEngine::runKernelWithProfiling(const KernelRuntimeData& kernelData,
 
         id = enqueueKernel(*kernel, kernelData.getGlobalSize(), kernelData.getLocalSize(), kernelArguments,
             getSharedMemorySizeInBytes(argumentPointers, kernelData.getLocalMemoryModifiers()), queue, overheadTimer.getElapsedTime());
-        kernelToEventMap[std::make_pair(kernelData.getName(), kernelData.getSource())].push_back(id);
+        kernelToEventMap[std::make_pair(kernelData.getProgramName(), kernelData.getSource())].push_back(id);
 
         profilingInstance->second->updateState();
     }
@@ -697,27 +810,15 @@ EventId CUDAEngine::runKernelWithProfiling(const KernelRuntimeData& kernelData,
 
     CUDAKernel* kernel;
     std::unique_ptr<CUDAKernel> kernelUnique;
-    auto key = std::make_pair(kernelData.getName(), kernelData.getSource());
+    auto key = std::make_pair(kernelData.getProgramName(), kernelData.getSource());
 
     if (kernelCacheFlag)
     {
-        if (kernelCache.find(key) == kernelCache.end())
-        {
-            if (kernelCache.size() >= kernelCacheCapacity)
-            {
-                clearKernelCache();
-            }
-            std::unique_ptr<CUDAProgram> program = createAndBuildProgram(kernelData.getSource());
-            auto kernel = std::make_unique<CUDAKernel>(program->getPtxSource(), kernelData.getName());
-            kernelCache.insert(std::make_pair(key, std::move(kernel)));
-        }
-        auto cachePointer = kernelCache.find(key);
-        kernel = cachePointer->second.get();
+        kernel = loadKernelFromCache(kernelData);
     }
     else
     {
-        std::unique_ptr<CUDAProgram> program = createAndBuildProgram(kernelData.getSource());
-        kernelUnique = std::make_unique<CUDAKernel>(program->getPtxSource(), kernelData.getName());
+        kernelUnique = std::make_unique<CUDAKernel>(createAndBuildProgram(kernelData), kernelData.getName());
         kernel = kernelUnique.get();
     }
 
@@ -726,7 +827,7 @@ EventId CUDAEngine::runKernelWithProfiling(const KernelRuntimeData& kernelData,
 
     if (kernelProfilingInstances.find(key) == kernelProfilingInstances.cend())
     {
-        initializeKernelProfiling(kernelData.getName(), kernelData.getSource());
+        initializeKernelProfiling(kernelData.getProgramName(), kernelData.getSource());
     }
 
     auto profilingInstance = kernelProfilingInstances.find(key);
@@ -872,11 +973,114 @@ void CUDAEngine::setKernelProfilingCounters(const std::vector<std::string>& coun
     #endif // KTT_PROFILING_CUPTI_LEGACY
 }
 
-std::unique_ptr<CUDAProgram> CUDAEngine::createAndBuildProgram(const std::string& source) const
+std::string CUDAEngine::createAndBuildProgram(const KernelRuntimeData& kernelData) const
+{
+    return buildPtxSource(kernelData.getSource(), getProgramOptions(kernelData));
+}
+
+std::future<std::string> CUDAEngine::createAndBuildProgramAsync(const KernelRuntimeData& kernelData, const bool lowPriority)
+{
+    const std::string source = kernelData.getSource();
+    const std::string options = getProgramOptions(kernelData);
+
+    return compilationPool.enqueue([this, source, options]()
+    {
+        return buildPtxSource(source, options);
+    }, lowPriority);
+}
+
+std::string CUDAEngine::getProgramOptions(const KernelRuntimeData& kernelData) const
+{
+    if (kernelData.getCompilerOptions().empty())
+    {
+        return compilerOptions;
+    }
+
+    if (compilerOptions.empty())
+    {
+        return kernelData.getCompilerOptions();
+    }
+
+    return compilerOptions + " " + kernelData.getCompilerOptions();
+}
+
+std::string CUDAEngine::buildPtxSource(const std::string& source, const std::string& options) const
 {
-    auto program = std::make_unique<CUDAProgram>(source);
-    program->build(compilerOptions);
-    return program;
+    const std::string binaryKey = binaryCacheIdentity + options + "\n" + source;
+    std::string ptxSource;
+
+    std::string failureMessage;
+    if (failureCache.find(binaryKey, failureMessage))
+    {
+        throw std::runtime_error(std::string("Compilation skipped, the same program failed to compile before: ") + failureMessage);
+    }
+
+    if (binaryCache.isEnabled() && binaryCache.load(binaryKey, ptxSource))
+    {
+        return ptxSource;
+    }
+
+    CUDAProgram program(source);
+
+    try
+    {
+        program.build(options);
+    }
+    catch (const std::runtime_error& error)
+    {
+        failureCache.insert(binaryKey, error.what(), program.hasCompilationError());
+        throw;
+    }
+
+    ptxSource = program.getPtxSource();
+
+    if (binaryCache.isEnabled())
+    {
+        binaryCache.store(binaryKey, ptxSource);
+    }
+
+    return ptxSource;
+}
+
+CUDAKernel* CUDAEngine::loadKernelFromCache(const KernelRuntimeData& kernelData)
+{
+    auto cachedKernel = kernelCache.find(kernelData.getProgramName(), kernelData.getSource());
+
+    if (cachedKernel != nullptr)
+    {
+        return cachedKernel->get();
+    }
+
+    const auto key = std::make_pair(kernelData.getProgramName(), kernelData.getSource());
+    std::string ptxSource;
+    auto pendingPointer = pendingPrograms.find(key);
+
+    if (pendingPointer != pendingPrograms.end())
+    {
+        std::future<std::string> pendingProgram = std::move(pendingPointer->second);
+        pendingPrograms.erase(pendingPointer);
+        speculativePrograms.erase(std::remove(speculativePrograms.begin(), speculativePrograms.end(), key), speculativePrograms.end());
+
+        // Errors from background compilation are rethrown here, the same way as if the program was compiled synchronously
+        try
+        {
+            ptxSource = pendingProgram.get();
+        }
+        catch (const std::future_error&)
+        {
+            // Speculative compilation was discarded by compilation pool before it started
+            ptxSource = createAndBuildProgram(kernelData);
+        }
+    }
+    else
+    {
+        ptxSource = createAndBuildProgram(kernelData);
+    }
+
+    auto kernel = std::make_unique<CUDAKernel>(ptxSource, kernelData.getName());
+    CUDAKernel* kernelPointer = kernel.get();
+    kernelCache.insert(kernelData.getProgramName(), kernelData.getSource(), std::move(kernel));
+    return kernelPointer;
 }
 
 EventId CUDAEngine::enqueueKernel(CUDAKernel& kernel, const std::vector<size_t>& globalSize, const std::vector<size_t>& localSize,
@@ -1089,26 +1293,131 @@ CUDABuffer* CUDAEngine::findBuffer(const ArgumentId id) const
 {
     if (persistentBufferFlag)
     {
-        for (const auto& buffer : persistentBuffers)
+        auto persistentPointer = persistentBuffers.find(id);
+
+        if (persistentPointer != persistentBuffers.end())
         {
-            if (buffer->getKernelArgumentId() == id)
-            {
-                return buffer.get();
-            }
+            return persistentPointer->second.get();
         }
     }
 
-    for (const auto& buffer : buffers)
+    auto bufferPointer = buffers.find(id);
+
+    if (bufferPointer != buffers.end())
     {
-        if (buffer->getKernelArgumentId() == id)
-        {
-            return buffer.get();
-        }
+        return bufferPointer->second.get();
     }
 
     return nullptr;
 }
 
+const CUDABuffer* CUDAEngine::findArgumentSnapshot(const KernelArgument& kernelArgument)
+{
+    auto snapshotPointer = argumentSnapshots.find(kernelArgument.getId());
+
+    if (snapshotPointer == argumentSnapshots.end())
+    {
+        return nullptr;
+    }
+
+    // Snapshot is discarded if host data of the argument was updated since its creation, even if its address and size remain the same
+    if (snapshotPointer->second.first != kernelArgument.getDataVersion()
+        || snapshotPointer->second.second->getBufferSize() != kernelArgument.getDataSizeInBytes())
+    {
+        argumentSnapshots.erase(snapshotPointer);
+        return nullptr;
+    }
+
+    Logger::getLogger().log(LoggingLevel::Debug, "Restoring buffer for argument " + std::to_string(kernelArgument.getId())
+        + " from device snapshot");
+    return snapshotPointer->second.second.get();
+}
+
+void CUDAEngine::createArgumentSnapshot(KernelArgument& kernelArgument, const CUDABuffer& buffer, const QueueId queue)
+{
+    auto snapshot = std::make_unique<CUDABuffer>(kernelArgument, false, &bufferPool);
+
+    // Copy is issued after the upload into the same stream, so it does not need to be waited for
+    CUDAEvent startEvent(nextEventId, true);
+    CUDAEvent endEvent(nextEventId, true);
+    snapshot->uploadData(streams.at(queue)->getStream(), &buffer, kernelArgument.getDataSizeInBytes(), startEvent.getEvent(),
+        endEvent.getEvent());
+
+    argumentSnapshots[kernelArgument.getId()] = std::make_pair(kernelArgument.getDataVersion(), std::move(snapshot));
+}
+
+const void* CUDAEngine::getUploadSource(const EventId id, const CUDABuffer& buffer, const void* data, const size_t dataSize)
+{
+    if (!pinnedStagingFlag || buffer.getMemoryLocation() != ArgumentMemoryLocation::Device)
+    {
+        return data;
+    }
+
+    CUDAStagingBuffer staging = acquireStagingBuffer(dataSize);
+
+    // Host copy is a part of the transfer, so that its duration is comparable to the duration of transfer without staging
+    Timer timer;
+    timer.start();
+    std::memcpy(staging.data, data, dataSize);
+    timer.stop();
+
+    stagingBuffers[id] = std::make_pair(staging, timer.getElapsedTime());
+    return staging.data;
+}
+
+uint64_t CUDAEngine::downloadThroughStagingBuffer(const CUDABuffer& buffer, void* destination, const size_t dataSize) const
+{
+    CUDAStagingBuffer staging = acquireStagingBuffer(dataSize);
+    EventId eventId = nextEventId;
+    auto startEvent = std::make_unique<CUDAEvent>(eventId, true);
+    auto endEvent = std::make_unique<CUDAEvent>(eventId, true);
+
+    Logger::getLogger().log(LoggingLevel::Debug, "Downloading buffer for argument " + std::to_string(buffer.getKernelArgumentId())
+        + " through staging buffer, event id: " + std::to_string(eventId));
+    buffer.downloadData(streams.at(getDefaultQueue())->getStream(), staging.data, dataSize, startEvent->getEvent(), endEvent->getEvent());
+
+    bufferEvents.insert(std::make_pair(eventId, std::make_pair(std::move(startEvent), std::move(endEvent))));
+    nextEventId++;
+
+    const uint64_t transferDuration = getArgumentOperationDuration(eventId);
+
+    Timer timer;
+    timer.start();
+    std::memcpy(destination, staging.data, dataSize);
+    timer.stop();
+
+    stagingPool.release(0, staging.size, staging);
+    return transferDuration + timer.getElapsedTime();
+}
+
+CUDAStagingBuffer CUDAEngine::acquireStagingBuffer(const size_t dataSize) const
+{
+    CUDAStagingBuffer staging;
+    staging.size = DeviceMemoryPool<CUDAStagingBuffer>::getSizeClass(dataSize);
+
+    if (!stagingPool.acquire(0, staging.size, staging))
+    {
+        checkCUDAError(cuMemAllocHost(&staging.data, staging.size), "cuMemAllocHost");
+    }
+
+    return staging;
+}
+
+uint64_t CUDAEngine::releaseStagingBuffer(const EventId id) const
+{
+    auto stagingPointer = stagingBuffers.find(id);
+
+    if (stagingPointer == stagingBuffers.end())
+    {
+        return 0;
+    }
+
+    const uint64_t copyDuration = stagingPointer->second.second;
+    stagingPool.release(0, stagingPointer->second.first.size, stagingPointer->second.first);
+    stagingBuffers.erase(stagingPointer);
+    return copyDuration;
+}
+
 CUdeviceptr* CUDAEngine::loadBufferFromCache(const ArgumentId id) const
 {
     CUDABuffer* buffer = findBuffer(id);
@@ -2,11 +2,14 @@
 
 #ifdef KTT_PLATFORM_CUDA
 
+#include <deque>
+#include <future>
 #include <map>
 #include <memory>
 #include <ostream>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <cuda.h>
@@ -17,9 +20,14 @@
 #include <compute_engine/cuda/cuda_event.h>
 #include <compute_engine/cuda/cuda_kernel.h>
 #include <compute_engine/cuda/cuda_program.h>
+#include <compute_engine/cuda/cuda_staging_buffer.h>
 #include <compute_engine/cuda/cuda_stream.h>
 #include <compute_engine/cuda/cuda_utility.h>
+#include <compute_engine/compilation_failure_cache.h>
 #include <compute_engine/compute_engine.h>
+#include <compute_engine/kernel_cache.h>
+#include <compute_engine/program_binary_cache.h>
+#include <utility/thread_pool.h>
 
 #ifdef KTT_PROFILING_CUPTI_LEGACY
 #include <cupti.h>
@@ -45,14 +53,21 @@ public:
     EventId runKernelAsync(const KernelRuntimeData& kernelData, const std::vector<KernelArgument*>& argumentPointers, const QueueId queue) override;
     KernelResult getKernelResult(const EventId id, const std::vector<OutputDescriptor>& outputDescriptors) const override;
     uint64_t getKernelOverhead(const EventId id) const override;
+    void precompileKernel(const KernelRuntimeData& kernelData, const bool speculative) override;
 
     // Utility methods
     void setCompilerOptions(const std::string& options) override;
+    void setSpecializationConstantUsage(const bool flag) override;
     void setGlobalSizeType(const GlobalSizeType type) override;
     void setAutomaticGlobalSizeCorrection(const bool flag) override;
     void setKernelCacheUsage(const bool flag) override;
     void setKernelCacheCapacity(const size_t capacity) override;
     void clearKernelCache() override;
+    KernelCacheStatistics getKernelCacheStatistics() const override;
+    void setPersistentKernelCache(const std::string& directory, const size_t maximumSize) override;
+    std::map<std::string, uint64_t> getCompilationFailureCauses() const override;
+    void setCompilationThreadCount(const size_t count) override;
+    void setSpeculativeCacheCapacity(const size_t capacity) override;
 
     // Queue handling methods
     QueueId getDefaultQueue() const override;
@@ -73,8 +88,11 @@ public:
     EventId copyArgumentAsync(const ArgumentId destination, const ArgumentId source, const size_t dataSizeInBytes, const QueueId queue) override;
     uint64_t persistArgument(KernelArgument& kernelArgument, const bool flag) override;
     uint64_t getArgumentOperationDuration(const EventId id) const override;
+    size_t getArgumentBufferSize(const ArgumentId id) const override;
     void resizeArgument(const ArgumentId id, const size_t newSize, const bool preserveData) override;
     void setPersistentBufferUsage(const bool flag) override;
+    void setArgumentSnapshotUsage(const bool flag) override;
+    void setPinnedStagingUsage(const bool flag) override;
     void clearBuffer(const ArgumentId id) override;
     void clearBuffers() override;
     void clearBuffers(const ArgumentAccessType accessType) override;
@@ -100,16 +118,27 @@ private:
     GlobalSizeType globalSizeType;
     bool globalSizeCorrection;
     bool kernelCacheFlag;
-    size_t kernelCacheCapacity;
+    size_t speculativeCacheCapacity;
     bool persistentBufferFlag;
+    bool argumentSnapshotFlag;
+    bool pinnedStagingFlag;
     mutable EventId nextEventId;
     std::unique_ptr<CUDAContext> context;
     std::vector<std::unique_ptr<CUDAStream>> streams;
-    std::set<std::unique_ptr<CUDABuffer>> buffers;
-    std::set<std::unique_ptr<CUDABuffer>> persistentBuffers;
-    std::map<std::pair<std::string, std::string>, std::unique_ptr<CUDAKernel>> kernelCache;
+    DeviceMemoryPool<CUdeviceptr> bufferPool;
+    std::unordered_map<ArgumentId, std::unique_ptr<CUDABuffer>> buffers;
+    std::unordered_map<ArgumentId, std::unique_ptr<CUDABuffer>> persistentBuffers;
+    std::unordered_map<ArgumentId, std::pair<uint64_t, std::unique_ptr<CUDABuffer>>> argumentSnapshots;
+    KernelCache<std::unique_ptr<CUDAKernel>> kernelCache;
+    std::map<std::pair<std::string, std::string>, std::future<std::string>> pendingPrograms;
+    std::deque<std::pair<std::string, std::string>> speculativePrograms;
+    mutable ProgramBinaryCache binaryCache;
+    std::string binaryCacheIdentity;
+    mutable CompilationFailureCache failureCache;
     mutable std::map<EventId, std::pair<std::unique_ptr<CUDAEvent>, std::unique_ptr<CUDAEvent>>> kernelEvents;
     mutable std::map<EventId, std::pair<std::unique_ptr<CUDAEvent>, std::unique_ptr<CUDAEvent>>> bufferEvents;
+    mutable DeviceMemoryPool<CUDAStagingBuffer> stagingPool;
+    mutable std::map<EventId, std::pair<CUDAStagingBuffer, uint64_t>> stagingBuffers;
 
     #ifdef KTT_PROFILING_CUPTI_LEGACY
     std::vector<std::pair<std::string, CUpti_MetricID>> profilingMetrics;
@@ -123,7 +152,14 @@ private:
     std::map<std::pair<std::string, std::string>, std::unique_ptr<CUPTIProfilingInstance>> kernelProfilingInstances;
     #endif // KTT_PROFILING_CUPTI
 
-    std::unique_ptr<CUDAProgram> createAndBuildProgram(const std::string& source) const;
+    // Declared last, so that background compilation is stopped before other resources are released
+    ThreadPool compilationPool;
+
+    std::string createAndBuildProgram(const KernelRuntimeData& kernelData) const;
+    std::string buildPtxSource(const std::string& source, const std::string& options) const;
+    std::future<std::string> createAndBuildProgramAsync(const KernelRuntimeData& kernelData, const bool lowPriority);
+    std::string getProgramOptions(const KernelRuntimeData& kernelData) const;
+    CUDAKernel* loadKernelFromCache(const KernelRuntimeData& kernelData);
     EventId enqueueKernel(CUDAKernel& kernel, const std::vector<size_t>& globalSize, const std::vector<size_t>& localSize,
         const std::vector<CUdeviceptr*>& kernelArguments, const size_t localMemorySize, const QueueId queue, const uint64_t kernelLaunchOverhead);
     KernelResult createKernelResult(const EventId id) const;
@@ -132,6 +168,12 @@ private:
     std::vector<CUdeviceptr*> getKernelArguments(const std::vector<KernelArgument*>& argumentPointers);
     size_t getSharedMemorySizeInBytes(const std::vector<KernelArgument*>& argumentPointers, const std::vector<LocalMemoryModifier>& modifiers) const;
     CUDABuffer* findBuffer(const ArgumentId id) const;
+    const CUDABuffer* findArgumentSnapshot(const KernelArgument& kernelArgument);
+    void createArgumentSnapshot(KernelArgument& kernelArgument, const CUDABuffer& buffer, const QueueId queue);
+    const void* getUploadSource(const EventId id, const CUDABuffer& buffer, const void* data, const size_t dataSize);
+    uint64_t downloadThroughStagingBuffer(const CUDABuffer& buffer, void* destination, const size_t dataSize) const;
+    CUDAStagingBuffer acquireStagingBuffer(const size_t dataSize) const;
+    uint64_t releaseStagingBuffer(const EventId id) const;
     CUdeviceptr* loadBufferFromCache(const ArgumentId id) const;
 
     #ifdef KTT_PROFILING_CUPTI_LEGACY
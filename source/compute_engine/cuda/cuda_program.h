@@ -16,7 +16,8 @@ class CUDAProgram
 {
 public:
     explicit CUDAProgram(const std::string& source) :
-        source(source)
+        source(source),
+        buildResult(NVRTC_SUCCESS)
     {
         auto sourcePointer = &source[0];
         checkCUDAError(nvrtcCreateProgram(&program, sourcePointer, nullptr, 0, nullptr, nullptr), "nvrtcCreateProgram");
@@ -49,6 +50,7 @@ public:
         }
 
         nvrtcResult result = nvrtcCompileProgram(program, static_cast<int>(individualOptionsChar.size()), individualOptionsChar.data());
+        buildResult = result;
 
         for (size_t i = 0; i < individualOptionsChar.size(); i++)
         {
@@ -88,6 +90,12 @@ public:
         return infoString;
     }
 
+    // Distinguishes errors reported by compiler from other build errors, eg. lack of resources
+    bool hasCompilationError() const
+    {
+        return buildResult == NVRTC_ERROR_COMPILATION;
+    }
+
     const std::string& getSource() const
     {
         return source;
@@ -101,6 +109,7 @@ public:
 private:
     std::string source;
     nvrtcProgram program;
+    nvrtcResult buildResult;
 };
 
 } // namespace ktt
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ktt
+{
+
+// Page-locked host memory, transfers between it and device buffers are performed directly by DMA engine and can overlap with other work
+struct CUDAStagingBuffer
+{
+    void* data;
+    size_t size;
+};
+
+} // namespace ktt
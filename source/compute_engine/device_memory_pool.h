@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace ktt
+{
+
+// Keeps released device allocations, so that buffers of the same size created for subsequent kernel configurations can reuse them instead
+// of allocating new memory. Allocations are grouped by memory flags and size class, the least recently released ones are freed first once
+// the total size of kept allocations exceeds capacity.
+template <typename Allocation>
+class DeviceMemoryPool
+{
+public:
+    explicit DeviceMemoryPool(const size_t capacity, const std::function<void(Allocation)>& deleter) :
+        capacity(capacity),
+        pooledSize(0),
+        deleter(deleter)
+    {}
+
+    ~DeviceMemoryPool()
+    {
+        clear();
+    }
+
+    // Size has to be rounded to size class before the call, found allocation is removed from the pool
+    bool acquire(const uint64_t flags, const size_t size, Allocation& allocation)
+    {
+        auto classPointer = freeAllocations.find(std::make_pair(flags, size));
+
+        if (classPointer == freeAllocations.end() || classPointer->second.empty())
+        {
+            return false;
+        }
+
+        auto entryPointer = classPointer->second.back();
+        classPointer->second.pop_back();
+        allocation = entryPointer->allocation;
+        pooledSize -= size;
+        releaseOrder.erase(entryPointer);
+        return true;
+    }
+
+    void release(const uint64_t flags, const size_t size, Allocation allocation)
+    {
+        if (size > capacity)
+        {
+            deleter(allocation);
+            return;
+        }
+
+        releaseOrder.push_front(Entry{flags, size, allocation});
+        freeAllocations[std::make_pair(flags, size)].push_back(releaseOrder.begin());
+        pooledSize += size;
+
+        while (pooledSize > capacity)
+        {
+            evictLeastRecentlyReleased();
+        }
+    }
+
+    void setCapacity(const size_t capacity)
+    {
+        this->capacity = capacity;
+
+        while (pooledSize > capacity)
+        {
+            evictLeastRecentlyReleased();
+        }
+    }
+
+    void clear()
+    {
+        while (!releaseOrder.empty())
+        {
+            evictLeastRecentlyReleased();
+        }
+    }
+
+    size_t getPooledSize() const
+    {
+        return pooledSize;
+    }
+
+    // Sizes are rounded up to a quarter of their highest power of two, which limits wasted memory to 25 percent
+    static size_t getSizeClass(const size_t size)
+    {
+        const size_t minimumSizeClass = 256;
+
+        if (size <= minimumSizeClass)
+        {
+            return minimumSizeClass;
+        }
+
+        size_t highestPower = 1;
+        while (highestPower <= size / 2)
+        {
+            highestPower *= 2;
+        }
+
+        const size_t step = highestPower / 4;
+        return (size + step - 1) / step * step;
+    }
+
+private:
+    struct Entry
+    {
+        uint64_t flags;
+        size_t size;
+        Allocation allocation;
+    };
+
+    size_t capacity;
+    size_t pooledSize;
+    std::function<void(Allocation)> deleter;
+    std::list<Entry> releaseOrder;
+    std::map<std::pair<uint64_t, size_t>, std::vector<typename std::list<Entry>::iterator>> freeAllocations;
+
+    void evictLeastRecentlyReleased()
+    {
+        const Entry& entry = releaseOrder.back();
+        auto& classEntries = freeAllocations[std::make_pair(entry.flags, entry.size)];
+
+        // Entries of the same class are released in order, so the least recently released one is the first one
+        classEntries.erase(classEntries.begin());
+        pooledSize -= entry.size;
+        deleter(entry.allocation);
+        releaseOrder.pop_back();
+    }
+};
+
+} // namespace ktt
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <api/kernel_cache_statistics.h>
+#include <utility/ktt_utility.h>
+
+namespace ktt
+{
+
+template <typename Value>
+class KernelCache
+{
+public:
+    explicit KernelCache(const size_t capacity) :
+        capacity(capacity),
+        hitCount(0),
+        missCount(0),
+        evictionCount(0)
+    {}
+
+    // Returns null pointer if the kernel is not cached, found kernel becomes the most recently used one
+    Value* find(const std::string& name, const std::string& source)
+    {
+        auto entryPointer = entries.find(getKey(name, source));
+
+        if (entryPointer == entries.end() || !entryPointer->second->matches(name, source))
+        {
+            missCount++;
+            return nullptr;
+        }
+
+        hitCount++;
+        usageList.splice(usageList.begin(), usageList, entryPointer->second);
+        return &entryPointer->second->value;
+    }
+
+    // Does not affect statistics nor order of eviction
+    bool contains(const std::string& name, const std::string& source) const
+    {
+        auto entryPointer = entries.find(getKey(name, source));
+        return entryPointer != entries.end() && entryPointer->second->matches(name, source);
+    }
+
+    Value& insert(const std::string& name, const std::string& source, Value value)
+    {
+        const uint64_t key = getKey(name, source);
+        auto entryPointer = entries.find(key);
+
+        // Entry with colliding digest is replaced
+        if (entryPointer != entries.end())
+        {
+            usageList.erase(entryPointer->second);
+            entries.erase(entryPointer);
+            evictionCount++;
+        }
+
+        while (!usageList.empty() && usageList.size() >= capacity)
+        {
+            evictLeastRecentlyUsed();
+        }
+
+        usageList.push_front(Entry{key, name, source, std::move(value)});
+        entries[key] = usageList.begin();
+        return usageList.front().value;
+    }
+
+    void setCapacity(const size_t capacity)
+    {
+        this->capacity = capacity;
+
+        while (usageList.size() > capacity)
+        {
+            evictLeastRecentlyUsed();
+        }
+    }
+
+    void clear()
+    {
+        entries.clear();
+        usageList.clear();
+    }
+
+    size_t getSize() const
+    {
+        return usageList.size();
+    }
+
+    KernelCacheStatistics getStatistics() const
+    {
+        return KernelCacheStatistics(hitCount, missCount, evictionCount, usageList.size(), capacity);
+    }
+
+    // 64-bit FNV-1a digest, so that lookups do not have to compare whole kernel sources
+    static uint64_t getKey(const std::string& name, const std::string& source)
+    {
+        // Separator prevents collisions between different splits of the same concatenated string
+        return getFnvHash(source, getFnvHash(std::string(1, '\0'), getFnvHash(name)));
+    }
+
+private:
+    struct Entry
+    {
+        uint64_t key;
+        std::string name;
+        std::string source;
+        Value value;
+
+        // Full comparison is only performed once the digest matches, in order to rule out collisions
+        bool matches(const std::string& otherName, const std::string& otherSource) const
+        {
+            return name == otherName && source == otherSource;
+        }
+    };
+
+    size_t capacity;
+    uint64_t hitCount;
+    uint64_t missCount;
+    uint64_t evictionCount;
+    std::list<Entry> usageList;
+    std::unordered_map<uint64_t, typename std::list<Entry>::iterator> entries;
+
+    void evictLeastRecentlyUsed()
+    {
+        entries.erase(usageList.back().key);
+        usageList.pop_back();
+        evictionCount++;
+    }
+};
+
+} // namespace ktt
@@ -8,6 +8,7 @@
 #include <vector>
 #include <CL/cl.h>
 #include <compute_engine/opencl/opencl_event.h>
+#include <compute_engine/device_memory_pool.h>
 #include <compute_engine/opencl/opencl_utility.h>
 #include <enum/argument_access_type.h>
 #include <enum/argument_data_type.h>
@@ -21,6 +22,11 @@ class OpenCLBuffer
 {
 public:
     explicit OpenCLBuffer(const cl_context context, KernelArgument& kernelArgument, const bool zeroCopy) :
+        OpenCLBuffer(context, kernelArgument, zeroCopy, nullptr)
+    {}
+
+    // Buffers using memory pool take their allocations from it and return them there once they are released
+    explicit OpenCLBuffer(const cl_context context, KernelArgument& kernelArgument, const bool zeroCopy, DeviceMemoryPool<cl_mem>* memoryPool) :
         context(context),
         kernelArgumentId(kernelArgument.getId()),
         bufferSize(kernelArgument.getDataSizeInBytes()),
@@ -30,7 +36,8 @@ public:
         accessType(kernelArgument.getAccessType()),
         openclMemoryFlag(getOpenCLMemoryType(accessType)),
         hostPointer(nullptr),
-        zeroCopy(zeroCopy)
+        zeroCopy(zeroCopy),
+        memoryPool(zeroCopy ? nullptr : memoryPool)
     {
         if (memoryLocation == ArgumentMemoryLocation::Host)
         {
@@ -45,14 +52,12 @@ public:
             }
         }
 
-        cl_int result;
-        buffer = clCreateBuffer(context, openclMemoryFlag, bufferSize, hostPointer, &result);
-        checkOpenCLError(result, "clCreateBuffer");
+        buffer = allocateBuffer(bufferSize, allocationSize);
     }
 
     ~OpenCLBuffer()
     {
-        checkOpenCLError(clReleaseMemObject(buffer), "clReleaseMemObject");
+        releaseBuffer(buffer, allocationSize);
     }
 
     void resize(cl_command_queue queue, const size_t newBufferSize, const bool preserveData)
@@ -69,27 +74,25 @@ public:
 
         if (!preserveData)
         {
-            checkOpenCLError(clReleaseMemObject(buffer), "clReleaseMemObject");
-            cl_int result;
-            buffer = clCreateBuffer(context, openclMemoryFlag, newBufferSize, hostPointer, &result);
-            checkOpenCLError(result, "clCreateBuffer");
+            releaseBuffer(buffer, allocationSize);
+            buffer = allocateBuffer(newBufferSize, allocationSize);
         }
         else
         {
-            cl_mem newBuffer;
-            cl_int result;
+            size_t newAllocationSize;
+            cl_mem newBuffer = allocateBuffer(newBufferSize, newAllocationSize);
             auto event = std::make_unique<OpenCLEvent>(0, true);
 
-            newBuffer = clCreateBuffer(context, openclMemoryFlag, newBufferSize, hostPointer, &result);
-            checkOpenCLError(result, "clCreateBuffer");
-            result = clEnqueueCopyBuffer(queue, buffer, newBuffer, 0, 0, std::min(bufferSize, newBufferSize), 0, nullptr, event->getEvent());
+            cl_int result = clEnqueueCopyBuffer(queue, buffer, newBuffer, 0, 0, std::min(bufferSize, newBufferSize), 0, nullptr,
+                event->getEvent());
             checkOpenCLError(result, "clEnqueueCopyBuffer");
 
             event->setReleaseFlag();
             checkOpenCLError(clWaitForEvents(1, event->getEvent()), "clWaitForEvents");
 
-            checkOpenCLError(clReleaseMemObject(buffer), "clReleaseMemObject");
+            releaseBuffer(buffer, allocationSize);
             buffer = newBuffer;
+            allocationSize = newAllocationSize;
         }
 
         bufferSize = newBufferSize;
@@ -232,6 +235,40 @@ private:
     cl_mem buffer;
     void* hostPointer;
     bool zeroCopy;
+    DeviceMemoryPool<cl_mem>* memoryPool;
+    size_t allocationSize;
+
+    cl_mem allocateBuffer(const size_t size, size_t& allocatedSize)
+    {
+        cl_mem newBuffer;
+        allocatedSize = size;
+
+        if (memoryPool != nullptr)
+        {
+            allocatedSize = DeviceMemoryPool<cl_mem>::getSizeClass(size);
+
+            if (memoryPool->acquire(openclMemoryFlag, allocatedSize, newBuffer))
+            {
+                return newBuffer;
+            }
+        }
+
+        cl_int result;
+        newBuffer = clCreateBuffer(context, openclMemoryFlag, allocatedSize, hostPointer, &result);
+        checkOpenCLError(result, "clCreateBuffer");
+        return newBuffer;
+    }
+
+    void releaseBuffer(cl_mem releasedBuffer, const size_t allocatedSize)
+    {
+        if (memoryPool != nullptr)
+        {
+            memoryPool->release(openclMemoryFlag, allocatedSize, releasedBuffer);
+            return;
+        }
+
+        checkOpenCLError(clReleaseMemObject(releasedBuffer), "clReleaseMemObject");
+    }
 };
 
 } // namespace ktt
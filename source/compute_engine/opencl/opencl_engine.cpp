@@ -1,5 +1,7 @@
 #ifdef KTT_PLATFORM_OPENCL
 
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 #include <compute_engine/opencl/opencl_engine.h>
 #include <utility/ktt_utility.h>
@@ -20,9 +22,21 @@ OpenCLEngine::OpenCLEngine(const PlatformIndex platformIndex, const DeviceIndex
     globalSizeType(GlobalSizeType::OpenCL),
     globalSizeCorrection(false),
     kernelCacheFlag(true),
-    kernelCacheCapacity(10),
+    speculativeCacheCapacity(0),
     persistentBufferFlag(true),
-    nextEventId(0)
+    argumentSnapshotFlag(false),
+    pinnedStagingFlag(false),
+    nextEventId(0),
+    bufferPool(0, [](cl_mem buffer) { checkOpenCLError(clReleaseMemObject(buffer), "clReleaseMemObject"); }),
+    kernelCache(10),
+    failureCache(binaryCache),
+    stagingPool(0, [this](OpenCLStagingBuffer staging)
+    {
+        checkOpenCLError(clEnqueueUnmapMemObject(commandQueues.at(getDefaultQueue())->getQueue(), staging.buffer, staging.data, 0, nullptr,
+            nullptr), "clEnqueueUnmapMemObject");
+        checkOpenCLError(clReleaseMemObject(staging.buffer), "clReleaseMemObject");
+    }),
+    compilationPool(ThreadPool::getHardwareThreadCount())
 {
     #if defined(KTT_PROFILING_GPA) || defined(KTT_PROFILING_GPA_LEGACY)
     Logger::logDebug("Initializing GPA profiling API");
@@ -46,6 +60,16 @@ OpenCLEngine::OpenCLEngine(const PlatformIndex platformIndex, const DeviceIndex
     Logger::getLogger().log(LoggingLevel::Debug, "Initializing OpenCL context");
     context = std::make_unique<OpenCLContext>(platforms.at(platformIndex).getId(), std::vector<cl_device_id>{device});
 
+    // Compiled programs can only be reused on the same device with the same driver
+    binaryCacheIdentity = getPlatformInfoString(platforms.at(platformIndex).getId(), CL_PLATFORM_VERSION) + "\n"
+        + getDeviceInfoString(device, CL_DEVICE_NAME) + "\n" + getDeviceInfoString(device, CL_DRIVER_VERSION) + "\n";
+
+    // Allocations released between kernel configurations are kept for reuse up to a quarter of device memory
+    uint64_t globalMemorySize;
+    checkOpenCLError(clGetDeviceInfo(device, CL_DEVICE_GLOBAL_MEM_SIZE, sizeof(uint64_t), &globalMemorySize, nullptr), "clGetDeviceInfo");
+    bufferPool.setCapacity(static_cast<size_t>(globalMemorySize / 4));
+    stagingPool.setCapacity(static_cast<size_t>(globalMemorySize / 4));
+
     Logger::getLogger().log(LoggingLevel::Debug, "Initializing OpenCL queues");
     for (uint32_t i = 0; i < queueCount; i++)
     {
@@ -81,23 +105,11 @@ EventId OpenCLEngine::runKernelAsync(const KernelRuntimeData& kernelData, const
 
     if (kernelCacheFlag)
     {
-        if (kernelCache.find(std::make_pair(kernelData.getName(), kernelData.getSource())) == kernelCache.end())
-        {
-            if (kernelCache.size() >= kernelCacheCapacity)
-            {
-                clearKernelCache();
-            }
-            std::unique_ptr<OpenCLProgram> cacheProgram = createAndBuildProgram(kernelData.getSource());
-            auto cacheKernel = std::make_unique<OpenCLKernel>(context->getDevice(), cacheProgram->getProgram(), kernelData.getName());
-            kernelCache.insert(std::make_pair(std::make_pair(kernelData.getName(), kernelData.getSource()), std::make_pair(std::move(cacheKernel),
-                std::move(cacheProgram))));
-        }
-        auto cachePointer = kernelCache.find(std::make_pair(kernelData.getName(), kernelData.getSource()));
-        kernel = cachePointer->second.first.get();
+        kernel = loadKernelFromCache(kernelData);
     }
     else
     {
-        program = createAndBuildProgram(kernelData.getSource());
+        program = buildProgram(kernelData.getSource(), getProgramOptions(kernelData));
         kernelUnique = std::make_unique<OpenCLKernel>(context->getDevice(), program->getProgram(), kernelData.getName());
         kernel = kernelUnique.get();
     }
@@ -147,11 +159,58 @@ uint64_t OpenCLEngine::getKernelOverhead(const EventId id) const
     return eventPointer->second->getOverhead();
 }
 
+void OpenCLEngine::precompileKernel(const KernelRuntimeData& kernelData, const bool speculative)
+{
+    const auto key = std::make_pair(kernelData.getProgramName(), kernelData.getSource());
+
+    if (!kernelCacheFlag || kernelCache.contains(kernelData.getProgramName(), kernelData.getSource()))
+    {
+        return;
+    }
+
+    if (pendingPrograms.find(key) != pendingPrograms.end())
+    {
+        if (!speculative)
+        {
+            // Program is going to be used for sure, so it is no longer subject to speculative cache capacity
+            speculativePrograms.erase(std::remove(speculativePrograms.begin(), speculativePrograms.end(), key), speculativePrograms.end());
+        }
+        return;
+    }
+
+    if (speculative && speculativeCacheCapacity == 0)
+    {
+        return;
+    }
+
+    // Only program build is performed in background, kernel object is created once the program is retrieved from cache
+    pendingPrograms.insert(std::make_pair(key, buildProgramAsync(kernelData.getSource(), getProgramOptions(kernelData), speculative)));
+
+    if (speculative)
+    {
+        speculativePrograms.push_back(key);
+
+        if (speculativePrograms.size() > speculativeCacheCapacity)
+        {
+            pendingPrograms.erase(speculativePrograms.front());
+            speculativePrograms.pop_front();
+        }
+    }
+}
+
 void OpenCLEngine::setCompilerOptions(const std::string& options)
 {
     compilerOptions = options;
 }
 
+void OpenCLEngine::setSpecializationConstantUsage(const bool flag)
+{
+    if (flag)
+    {
+        throw std::runtime_error("Specialization constants are not supported for OpenCL backend");
+    }
+}
+
 void OpenCLEngine::setGlobalSizeType(const GlobalSizeType type)
 {
     globalSizeType = type;
@@ -173,12 +232,46 @@ void OpenCLEngine::setKernelCacheUsage(const bool flag)
 
 void OpenCLEngine::setKernelCacheCapacity(const size_t capacity)
 {
-    kernelCacheCapacity = capacity;
+    kernelCache.setCapacity(capacity);
 }
 
 void OpenCLEngine::clearKernelCache()
 {
     kernelCache.clear();
+    pendingPrograms.clear();
+    speculativePrograms.clear();
+}
+
+KernelCacheStatistics OpenCLEngine::getKernelCacheStatistics() const
+{
+    return kernelCache.getStatistics();
+}
+
+void OpenCLEngine::setPersistentKernelCache(const std::string& directory, const size_t maximumSize)
+{
+    binaryCache.setDirectory(directory, maximumSize);
+}
+
+std::map<std::string, uint64_t> OpenCLEngine::getCompilationFailureCauses() const
+{
+    return failureCache.getFailureCauses();
+}
+
+void OpenCLEngine::setCompilationThreadCount(const size_t count)
+{
+    compilationPool.setThreadCount(count);
+}
+
+void OpenCLEngine::setSpeculativeCacheCapacity(const size_t capacity)
+{
+    speculativeCacheCapacity = capacity;
+    compilationPool.setLowPriorityTaskLimit(capacity);
+
+    while (speculativePrograms.size() > speculativeCacheCapacity)
+    {
+        pendingPrograms.erase(speculativePrograms.front());
+        speculativePrograms.pop_front();
+    }
 }
 
 QueueId OpenCLEngine::getDefaultQueue() const
@@ -218,6 +311,20 @@ void OpenCLEngine::synchronizeDevice()
 
 void OpenCLEngine::clearEvents()
 {
+    // Staging buffers can only be reused once the transfers utilizing them are finished
+    for (auto& staging : stagingBuffers)
+    {
+        auto eventPointer = bufferEvents.find(staging.first);
+
+        if (eventPointer != bufferEvents.end())
+        {
+            checkOpenCLError(clWaitForEvents(1, eventPointer->second->getEvent()), "clWaitForEvents");
+        }
+
+        stagingPool.release(0, staging.second.first.size, staging.second.first);
+    }
+
+    stagingBuffers.clear();
     kernelEvents.clear();
     bufferEvents.clear();
 
@@ -280,16 +387,33 @@ EventId OpenCLEngine::uploadArgumentAsync(KernelArgument& kernelArgument, const
     }
     else
     {
-        buffer = std::make_unique<OpenCLBuffer>(context->getContext(), kernelArgument, false);
+        buffer = std::make_unique<OpenCLBuffer>(context->getContext(), kernelArgument, false, &bufferPool);
         auto profilingEvent = std::make_unique<OpenCLEvent>(eventId, true);
-        buffer->uploadData(commandQueues.at(queue)->getQueue(), kernelArgument.getData(), kernelArgument.getDataSizeInBytes(),
-            profilingEvent->getEvent());
+        const OpenCLBuffer* snapshot = findArgumentSnapshot(kernelArgument);
+
+        if (snapshot != nullptr)
+        {
+            buffer->uploadData(commandQueues.at(queue)->getQueue(), snapshot->getBuffer(), kernelArgument.getDataSizeInBytes(),
+                profilingEvent->getEvent());
+        }
+        else
+        {
+            const void* source = getUploadSource(eventId, *buffer, kernelArgument.getData(), kernelArgument.getDataSizeInBytes());
+            buffer->uploadData(commandQueues.at(queue)->getQueue(), source, kernelArgument.getDataSizeInBytes(), profilingEvent->getEvent());
+        }
 
         profilingEvent->setReleaseFlag();
         bufferEvents.insert(std::make_pair(eventId, std::move(profilingEvent)));
+
+        // Referenced host data can be modified by user without notice, so only arguments which own their data are snapshotted
+        if (snapshot == nullptr && argumentSnapshotFlag && kernelArgument.getAccessType() != ArgumentAccessType::ReadOnly
+            && kernelArgument.getMemoryLocation() == ArgumentMemoryLocation::Device && kernelArgument.hasOwnedData())
+        {
+            createArgumentSnapshot(kernelArgument, *buffer, queue);
+        }
     }
 
-    buffers.insert(std::move(buffer)); // buffer data will be stolen
+    buffers[kernelArgument.getId()] = std::move(buffer);
     nextEventId++;
     return eventId;
 }
@@ -319,14 +443,9 @@ EventId OpenCLEngine::updateArgumentAsync(const ArgumentId id, const void* data,
     
     Logger::getLogger().log(LoggingLevel::Debug, "Updating buffer for argument " + std::to_string(id) + ", event id: " + std::to_string(eventId));
 
-    if (dataSizeInBytes == 0)
-    {
-        buffer->uploadData(commandQueues.at(queue)->getQueue(), data, buffer->getBufferSize(), profilingEvent->getEvent());
-    }
-    else
-    {
-        buffer->uploadData(commandQueues.at(queue)->getQueue(), data, dataSizeInBytes, profilingEvent->getEvent());
-    }
+    const size_t uploadSize = dataSizeInBytes == 0 ? buffer->getBufferSize() : dataSizeInBytes;
+    const void* source = getUploadSource(eventId, *buffer, data, uploadSize);
+    buffer->uploadData(commandQueues.at(queue)->getQueue(), source, uploadSize, profilingEvent->getEvent());
 
     profilingEvent->setReleaseFlag();
     bufferEvents.insert(std::make_pair(eventId, std::move(profilingEvent)));
@@ -336,6 +455,14 @@ EventId OpenCLEngine::updateArgumentAsync(const ArgumentId id, const void* data,
 
 uint64_t OpenCLEngine::downloadArgument(const ArgumentId id, void* destination, const size_t dataSizeInBytes) const
 {
+    const OpenCLBuffer* buffer = findBuffer(id);
+
+    // Asynchronous downloads are not staged, because data has to be copied from staging buffer after the transfer is finished
+    if (pinnedStagingFlag && buffer != nullptr && buffer->getMemoryLocation() == ArgumentMemoryLocation::Device)
+    {
+        return downloadThroughStagingBuffer(*buffer, destination, dataSizeInBytes == 0 ? buffer->getBufferSize() : dataSizeInBytes);
+    }
+
     EventId eventId = downloadArgumentAsync(id, destination, dataSizeInBytes, getDefaultQueue());
     return getArgumentOperationDuration(eventId);
 }
@@ -386,18 +513,7 @@ KernelArgument OpenCLEngine::downloadArgumentObject(const ArgumentId id, uint64_
     KernelArgument argument(buffer->getKernelArgumentId(), buffer->getBufferSize() / buffer->getElementSize(), buffer->getElementSize(),
         buffer->getDataType(), buffer->getMemoryLocation(), buffer->getAccessType(), ArgumentUploadType::Vector);
 
-    EventId eventId = nextEventId;
-    auto profilingEvent = std::make_unique<OpenCLEvent>(eventId, true);
-
-    Logger::getLogger().log(LoggingLevel::Debug, "Downloading buffer for argument " + std::to_string(id) + ", event id: " + std::to_string(eventId));
-    buffer->downloadData(commandQueues.at(getDefaultQueue())->getQueue(), argument.getData(), argument.getDataSizeInBytes(),
-        profilingEvent->getEvent());
-
-    profilingEvent->setReleaseFlag();
-    bufferEvents.insert(std::make_pair(eventId, std::move(profilingEvent)));
-    nextEventId++;
-
-    uint64_t duration = getArgumentOperationDuration(eventId);
+    uint64_t duration = downloadArgument(id, argument.getData(), argument.getDataSizeInBytes());
     if (downloadDuration != nullptr)
     {
         *downloadDuration = duration;
@@ -457,26 +573,14 @@ EventId OpenCLEngine::copyArgumentAsync(const ArgumentId destination, const Argu
 
 uint64_t OpenCLEngine::persistArgument(KernelArgument& kernelArgument, const bool flag)
 {
-    bool bufferFound = false;
-    auto iterator = persistentBuffers.cbegin();
+    auto bufferPointer = persistentBuffers.find(kernelArgument.getId());
+    const bool bufferFound = bufferPointer != persistentBuffers.end();
 
-    while (iterator != persistentBuffers.cend())
+    if (!flag && bufferFound)
     {
-        if (iterator->get()->getKernelArgumentId() == kernelArgument.getId())
-        {
-            bufferFound = true;
-            if (!flag)
-            {
-                persistentBuffers.erase(iterator);
-            }
-            break;
-        }
-        else
-        {
-            ++iterator;
-        }
+        persistentBuffers.erase(bufferPointer);
     }
-    
+
     if (flag && !bufferFound)
     {
         std::unique_ptr<OpenCLBuffer> buffer = nullptr;
@@ -501,7 +605,7 @@ uint64_t OpenCLEngine::persistArgument(KernelArgument& kernelArgument, const boo
             bufferEvents.insert(std::make_pair(eventId, std::move(profilingEvent)));
         }
 
-        persistentBuffers.insert(std::move(buffer)); // buffer data will be stolen
+        persistentBuffers[kernelArgument.getId()] = std::move(buffer);
         nextEventId++;
 
         return getArgumentOperationDuration(eventId);
@@ -532,7 +636,19 @@ uint64_t OpenCLEngine::getArgumentOperationDuration(const EventId id) const
     cl_ulong duration = eventPointer->second->getEventCommandDuration();
     bufferEvents.erase(id);
 
-    return static_cast<uint64_t>(duration);
+    return static_cast<uint64_t>(duration) + releaseStagingBuffer(id);
+}
+
+size_t OpenCLEngine::getArgumentBufferSize(const ArgumentId id) const
+{
+    OpenCLBuffer* buffer = findBuffer(id);
+
+    if (buffer == nullptr)
+    {
+        throw std::runtime_error(std::string("Buffer with following id was not found: ") + std::to_string(id));
+    }
+
+    return buffer->getBufferSize();
 }
 
 void OpenCLEngine::resizeArgument(const ArgumentId id, const size_t newSize, const bool preserveData)
@@ -553,24 +669,31 @@ void OpenCLEngine::setPersistentBufferUsage(const bool flag)
     persistentBufferFlag = flag;
 }
 
-void OpenCLEngine::clearBuffer(const ArgumentId id)
+void OpenCLEngine::setArgumentSnapshotUsage(const bool flag)
 {
-    auto iterator = buffers.cbegin();
+    argumentSnapshotFlag = flag;
 
-    while (iterator != buffers.cend())
+    if (!flag)
     {
-        if (iterator->get()->getKernelArgumentId() == id)
-        {
-            buffers.erase(iterator);
-            return;
-        }
-        else
-        {
-            ++iterator;
-        }
+        argumentSnapshots.clear();
     }
 }
 
+void OpenCLEngine::setPinnedStagingUsage(const bool flag)
+{
+    pinnedStagingFlag = flag;
+
+    if (!flag)
+    {
+        stagingPool.clear();
+    }
+}
+
+void OpenCLEngine::clearBuffer(const ArgumentId id)
+{
+    buffers.erase(id);
+}
+
 void OpenCLEngine::clearBuffers()
 {
     buffers.clear();
@@ -582,7 +705,7 @@ void OpenCLEngine::clearBuffers(const ArgumentAccessType accessType)
 
     while (iterator != buffers.cend())
     {
-        if (iterator->get()->getOpenclMemoryFlag() == getOpenCLMemoryType(accessType))
+        if (iterator->second->getOpenclMemoryFlag() == getOpenCLMemoryType(accessType))
         {
             iterator = buffers.erase(iterator);
         }
@@ -646,7 +769,7 @@ DeviceInfo OpenCLEngine::getCurrentDeviceInfo() const
 void OpenCLEngine::initializeKernelProfiling(const KernelRuntimeData& kernelData)
 {
     #if defined(KTT_PROFILING_GPA) || defined(KTT_PROFILING_GPA_LEGACY)
-    initializeKernelProfiling(kernelData.getName(), kernelData.getSource());
+    initializeKernelProfiling(kernelData.getProgramName(), kernelData.getSource());
     #else
     throw std::runtime_error("Support for kernel profiling is not included in this version of KTT framework");
     #endif // KTT_PROFILING_GPA || KTT_PROFILING_GPA_LEGACY
@@ -665,23 +788,11 @@ EventId OpenCLEngine::runKernelWithProfiling(const KernelRuntimeData& kernelData
 
     if (kernelCacheFlag)
     {
-        if (kernelCache.find(std::make_pair(kernelData.getName(), kernelData.getSource())) == kernelCache.end())
-        {
-            if (kernelCache.size() >= kernelCacheCapacity)
-            {
-                clearKernelCache();
-            }
-            std::unique_ptr<OpenCLProgram> cacheProgram = createAndBuildProgram(kernelData.getSource());
-            auto cacheKernel = std::make_unique<OpenCLKernel>(context->getDevice(), cacheProgram->getProgram(), kernelData.getName());
-            kernelCache.insert(std::make_pair(std::make_pair(kernelData.getName(), kernelData.getSource()), std::make_pair(std::move(cacheKernel),
-                std::move(cacheProgram))));
-        }
-        auto cachePointer = kernelCache.find(std::make_pair(kernelData.getName(), kernelData.getSource()));
-        kernel = cachePointer->second.first.get();
+        kernel = loadKernelFromCache(kernelData);
     }
     else
     {
-        program = createAndBuildProgram(kernelData.getSource());
+        program = buildProgram(kernelData.getSource(), getProgramOptions(kernelData));
         kernelUnique = std::make_unique<OpenCLKernel>(context->getDevice(), program->getProgram(), kernelData.getName());
         kernel = kernelUnique.get();
     }
@@ -703,15 +814,15 @@ EventId OpenCLEngine::runKernelWithProfiling(const KernelRuntimeData& kernelData
 
     overheadTimer.stop();
 
-    if (kernelProfilingInstances.find({kernelData.getName(), kernelData.getSource()}) == kernelProfilingInstances.end())
+    if (kernelProfilingInstances.find({kernelData.getProgramName(), kernelData.getSource()}) == kernelProfilingInstances.end())
     {
-        initializeKernelProfiling(kernelData.getName(), kernelData.getSource());
+        initializeKernelProfiling(kernelData.getProgramName(), kernelData.getSource());
     }
 
-    auto profilingInstance = kernelProfilingInstances.find({kernelData.getName(), kernelData.getSource()});
+    auto profilingInstance = kernelProfilingInstances.find({kernelData.getProgramName(), kernelData.getSource()});
     auto profilingPass = std::make_unique<GPAProfilingPass>(gpaInterface->getFunctionTable(), *profilingInstance->second.get());
     EventId id = enqueueKernel(*kernel, kernelData.getGlobalSize(), kernelData.getLocalSize(), queue, overheadTimer.getElapsedTime());
-    kernelToEventMap[std::make_pair(kernelData.getName(), kernelData.getSource())].push_back(id);
+    kernelToEventMap[std::make_pair(kernelData.getProgramName(), kernelData.getSource())].push_back(id);
     
     auto eventPointer = kernelEvents.find(id);
     Logger::logDebug(std::string("Performing kernel synchronization for event id: ") + std::to_string(id));
@@ -793,11 +904,129 @@ void OpenCLEngine::setKernelProfilingCounters(const std::vector<std::string>& co
 
 std::unique_ptr<OpenCLProgram> OpenCLEngine::createAndBuildProgram(const std::string& source) const
 {
+    return buildProgram(source, compilerOptions);
+}
+
+std::future<std::unique_ptr<OpenCLProgram>> OpenCLEngine::createAndBuildProgramAsync(const std::string& source, const bool lowPriority)
+{
+    return buildProgramAsync(source, compilerOptions, lowPriority);
+}
+
+std::string OpenCLEngine::getProgramOptions(const KernelRuntimeData& kernelData) const
+{
+    if (kernelData.getCompilerOptions().empty())
+    {
+        return compilerOptions;
+    }
+
+    if (compilerOptions.empty())
+    {
+        return kernelData.getCompilerOptions();
+    }
+
+    return compilerOptions + " " + kernelData.getCompilerOptions();
+}
+
+std::future<std::unique_ptr<OpenCLProgram>> OpenCLEngine::buildProgramAsync(const std::string& source, const std::string& options,
+    const bool lowPriority)
+{
+    return compilationPool.enqueue([this, source, options]()
+    {
+        return buildProgram(source, options);
+    }, lowPriority);
+}
+
+std::unique_ptr<OpenCLProgram> OpenCLEngine::buildProgram(const std::string& source, const std::string& options) const
+{
+    const std::string binaryKey = binaryCacheIdentity + options + "\n" + source;
+
+    std::string failureMessage;
+    if (failureCache.find(binaryKey, failureMessage))
+    {
+        throw std::runtime_error(std::string("Compilation skipped, the same program failed to compile before: ") + failureMessage);
+    }
+
+    if (binaryCache.isEnabled())
+    {
+        std::string binary;
+
+        if (binaryCache.load(binaryKey, binary))
+        {
+            try
+            {
+                auto program = std::make_unique<OpenCLProgram>(source, binary, context->getContext(), context->getDevices());
+                program->build(options);
+                return program;
+            }
+            catch (const std::runtime_error&)
+            {
+                Logger::logDebug("Cached program binary was rejected by OpenCL driver, program will be built from source");
+                binaryCache.remove(binaryKey);
+            }
+        }
+    }
+
     auto program = std::make_unique<OpenCLProgram>(source, context->getContext(), context->getDevices());
-    program->build(compilerOptions);
+
+    try
+    {
+        program->build(options);
+    }
+    catch (const std::runtime_error& error)
+    {
+        failureCache.insert(binaryKey, error.what(), program->hasCompilationError());
+        throw;
+    }
+
+    if (binaryCache.isEnabled())
+    {
+        binaryCache.store(binaryKey, program->getBinary());
+    }
+
     return program;
 }
 
+OpenCLKernel* OpenCLEngine::loadKernelFromCache(const KernelRuntimeData& kernelData)
+{
+    auto cachedKernel = kernelCache.find(kernelData.getProgramName(), kernelData.getSource());
+
+    if (cachedKernel != nullptr)
+    {
+        return cachedKernel->first.get();
+    }
+
+    const auto key = std::make_pair(kernelData.getProgramName(), kernelData.getSource());
+    std::unique_ptr<OpenCLProgram> program;
+    auto pendingPointer = pendingPrograms.find(key);
+
+    if (pendingPointer != pendingPrograms.end())
+    {
+        std::future<std::unique_ptr<OpenCLProgram>> pendingProgram = std::move(pendingPointer->second);
+        pendingPrograms.erase(pendingPointer);
+        speculativePrograms.erase(std::remove(speculativePrograms.begin(), speculativePrograms.end(), key), speculativePrograms.end());
+
+        // Errors from background build are rethrown here, the same way as if the program was built synchronously
+        try
+        {
+            program = pendingProgram.get();
+        }
+        catch (const std::future_error&)
+        {
+            // Speculative build was discarded by compilation pool before it started
+            program = buildProgram(kernelData.getSource(), getProgramOptions(kernelData));
+        }
+    }
+    else
+    {
+        program = buildProgram(kernelData.getSource(), getProgramOptions(kernelData));
+    }
+
+    auto kernel = std::make_unique<OpenCLKernel>(context->getDevice(), program->getProgram(), kernelData.getName());
+    OpenCLKernel* kernelPointer = kernel.get();
+    kernelCache.insert(kernelData.getProgramName(), kernelData.getSource(), std::make_pair(std::move(kernel), std::move(program)));
+    return kernelPointer;
+}
+
 void OpenCLEngine::setKernelArgument(OpenCLKernel& kernel, KernelArgument& argument)
 {
     if (argument.getUploadType() == ArgumentUploadType::Vector)
@@ -1000,26 +1229,138 @@ OpenCLBuffer* OpenCLEngine::findBuffer(const ArgumentId id) const
 {
     if (persistentBufferFlag)
     {
-        for (const auto& buffer : persistentBuffers)
+        auto persistentPointer = persistentBuffers.find(id);
+
+        if (persistentPointer != persistentBuffers.end())
         {
-            if (buffer->getKernelArgumentId() == id)
-            {
-                return buffer.get();
-            }
+            return persistentPointer->second.get();
         }
     }
 
-    for (const auto& buffer : buffers)
+    auto bufferPointer = buffers.find(id);
+
+    if (bufferPointer != buffers.end())
     {
-        if (buffer->getKernelArgumentId() == id)
-        {
-            return buffer.get();
-        }
+        return bufferPointer->second.get();
     }
 
     return nullptr;
 }
 
+const OpenCLBuffer* OpenCLEngine::findArgumentSnapshot(const KernelArgument& kernelArgument)
+{
+    auto snapshotPointer = argumentSnapshots.find(kernelArgument.getId());
+
+    if (snapshotPointer == argumentSnapshots.end())
+    {
+        return nullptr;
+    }
+
+    // Snapshot is discarded if host data of the argument was updated since its creation, even if its address and size remain the same
+    if (snapshotPointer->second.first != kernelArgument.getDataVersion()
+        || snapshotPointer->second.second->getBufferSize() != kernelArgument.getDataSizeInBytes())
+    {
+        argumentSnapshots.erase(snapshotPointer);
+        return nullptr;
+    }
+
+    Logger::getLogger().log(LoggingLevel::Debug, "Restoring buffer for argument " + std::to_string(kernelArgument.getId())
+        + " from device snapshot");
+    return snapshotPointer->second.second.get();
+}
+
+void OpenCLEngine::createArgumentSnapshot(KernelArgument& kernelArgument, const OpenCLBuffer& buffer, const QueueId queue)
+{
+    auto snapshot = std::make_unique<OpenCLBuffer>(context->getContext(), kernelArgument, false, &bufferPool);
+
+    // Copy is enqueued after the upload into the same queue, so it does not need to be waited for
+    OpenCLEvent copyEvent(nextEventId, true);
+    snapshot->uploadData(commandQueues.at(queue)->getQueue(), buffer.getBuffer(), kernelArgument.getDataSizeInBytes(), copyEvent.getEvent());
+    copyEvent.setReleaseFlag();
+
+    argumentSnapshots[kernelArgument.getId()] = std::make_pair(kernelArgument.getDataVersion(), std::move(snapshot));
+}
+
+const void* OpenCLEngine::getUploadSource(const EventId id, const OpenCLBuffer& buffer, const void* data, const size_t dataSize)
+{
+    if (!pinnedStagingFlag || buffer.getMemoryLocation() != ArgumentMemoryLocation::Device)
+    {
+        return data;
+    }
+
+    OpenCLStagingBuffer staging = acquireStagingBuffer(dataSize);
+
+    // Host copy is a part of the transfer, so that its duration is comparable to the duration of transfer without staging
+    Timer timer;
+    timer.start();
+    std::memcpy(staging.data, data, dataSize);
+    timer.stop();
+
+    stagingBuffers[id] = std::make_pair(staging, timer.getElapsedTime());
+    return staging.data;
+}
+
+uint64_t OpenCLEngine::downloadThroughStagingBuffer(const OpenCLBuffer& buffer, void* destination, const size_t dataSize) const
+{
+    OpenCLStagingBuffer staging = acquireStagingBuffer(dataSize);
+    EventId eventId = nextEventId;
+    auto profilingEvent = std::make_unique<OpenCLEvent>(eventId, true);
+
+    Logger::getLogger().log(LoggingLevel::Debug, "Downloading buffer for argument " + std::to_string(buffer.getKernelArgumentId())
+        + " through staging buffer, event id: " + std::to_string(eventId));
+    buffer.downloadData(commandQueues.at(getDefaultQueue())->getQueue(), staging.data, dataSize, profilingEvent->getEvent());
+
+    profilingEvent->setReleaseFlag();
+    bufferEvents.insert(std::make_pair(eventId, std::move(profilingEvent)));
+    nextEventId++;
+
+    const uint64_t transferDuration = getArgumentOperationDuration(eventId);
+
+    Timer timer;
+    timer.start();
+    std::memcpy(destination, staging.data, dataSize);
+    timer.stop();
+
+    stagingPool.release(0, staging.size, staging);
+    return transferDuration + timer.getElapsedTime();
+}
+
+OpenCLStagingBuffer OpenCLEngine::acquireStagingBuffer(const size_t dataSize) const
+{
+    OpenCLStagingBuffer staging;
+    staging.size = DeviceMemoryPool<OpenCLStagingBuffer>::getSizeClass(dataSize);
+
+    if (stagingPool.acquire(0, staging.size, staging))
+    {
+        return staging;
+    }
+
+    cl_int result;
+    staging.buffer = clCreateBuffer(context->getContext(), CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, staging.size, nullptr, &result);
+    checkOpenCLError(result, "clCreateBuffer");
+
+    staging.data = clEnqueueMapBuffer(commandQueues.at(getDefaultQueue())->getQueue(), staging.buffer, CL_TRUE, CL_MAP_READ | CL_MAP_WRITE, 0,
+        staging.size, 0, nullptr, nullptr, &result);
+    checkOpenCLError(result, "clEnqueueMapBuffer");
+
+    return staging;
+}
+
+uint64_t OpenCLEngine::releaseStagingBuffer(const EventId id) const
+{
+    auto stagingPointer = stagingBuffers.find(id);
+
+    if (stagingPointer == stagingBuffers.end())
+    {
+        return 0;
+    }
+
+    const uint64_t copyDuration = stagingPointer->second.second;
+    stagingPool.release(0, stagingPointer->second.first.size, stagingPointer->second.first);
+    stagingBuffers.erase(stagingPointer);
+    return copyDuration;
+}
+
 void OpenCLEngine::setKernelArgumentVector(OpenCLKernel& kernel, const OpenCLBuffer& buffer) const
 {
     cl_mem clBuffer = buffer.getBuffer();
@@ -2,11 +2,14 @@
 
 #ifdef KTT_PLATFORM_OPENCL
 
+#include <deque>
+#include <future>
 #include <map>
 #include <memory>
 #include <ostream>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <compute_engine/opencl/opencl_buffer.h>
 #include <compute_engine/opencl/opencl_command_queue.h>
@@ -16,7 +19,12 @@
 #include <compute_engine/opencl/opencl_kernel.h>
 #include <compute_engine/opencl/opencl_platform.h>
 #include <compute_engine/opencl/opencl_program.h>
+#include <compute_engine/opencl/opencl_staging_buffer.h>
+#include <compute_engine/compilation_failure_cache.h>
 #include <compute_engine/compute_engine.h>
+#include <compute_engine/kernel_cache.h>
+#include <compute_engine/program_binary_cache.h>
+#include <utility/thread_pool.h>
 
 #if defined(KTT_PROFILING_GPA) || defined(KTT_PROFILING_GPA_LEGACY)
 #include <compute_engine/opencl/gpa/gpa_interface.h>
@@ -39,14 +47,21 @@ public:
     EventId runKernelAsync(const KernelRuntimeData& kernelData, const std::vector<KernelArgument*>& argumentPointers, const QueueId queue) override;
     KernelResult getKernelResult(const EventId id, const std::vector<OutputDescriptor>& outputDescriptors) const override;
     uint64_t getKernelOverhead(const EventId id) const override;
+    void precompileKernel(const KernelRuntimeData& kernelData, const bool speculative) override;
 
     // Utility methods
     void setCompilerOptions(const std::string& options) override;
+    void setSpecializationConstantUsage(const bool flag) override;
     void setGlobalSizeType(const GlobalSizeType type) override;
     void setAutomaticGlobalSizeCorrection(const bool flag) override;
     void setKernelCacheUsage(const bool flag) override;
     void setKernelCacheCapacity(const size_t capacity) override;
     void clearKernelCache() override;
+    KernelCacheStatistics getKernelCacheStatistics() const override;
+    void setPersistentKernelCache(const std::string& directory, const size_t maximumSize) override;
+    std::map<std::string, uint64_t> getCompilationFailureCauses() const override;
+    void setCompilationThreadCount(const size_t count) override;
+    void setSpeculativeCacheCapacity(const size_t capacity) override;
 
     // Queue handling methods
     QueueId getDefaultQueue() const override;
@@ -67,8 +82,11 @@ public:
     EventId copyArgumentAsync(const ArgumentId destination, const ArgumentId source, const size_t dataSizeInBytes, const QueueId queue) override;
     uint64_t persistArgument(KernelArgument& kernelArgument, const bool flag) override;
     uint64_t getArgumentOperationDuration(const EventId id) const override;
+    size_t getArgumentBufferSize(const ArgumentId id) const override;
     void resizeArgument(const ArgumentId id, const size_t newSize, const bool preserveData) override;
     void setPersistentBufferUsage(const bool flag) override;
+    void setArgumentSnapshotUsage(const bool flag) override;
+    void setPinnedStagingUsage(const bool flag) override;
     void clearBuffer(const ArgumentId id) override;
     void clearBuffers() override;
     void clearBuffers(const ArgumentAccessType accessType) override;
@@ -89,6 +107,7 @@ public:
     void setKernelProfilingCounters(const std::vector<std::string>& counterNames) override;
 
     std::unique_ptr<OpenCLProgram> createAndBuildProgram(const std::string& source) const;
+    std::future<std::unique_ptr<OpenCLProgram>> createAndBuildProgramAsync(const std::string& source, const bool lowPriority = false);
 
 private:
     // Attributes
@@ -98,16 +117,27 @@ private:
     GlobalSizeType globalSizeType;
     bool globalSizeCorrection;
     bool kernelCacheFlag;
-    size_t kernelCacheCapacity;
+    size_t speculativeCacheCapacity;
     bool persistentBufferFlag;
+    bool argumentSnapshotFlag;
+    bool pinnedStagingFlag;
     mutable EventId nextEventId;
     std::unique_ptr<OpenCLContext> context;
     std::vector<std::unique_ptr<OpenCLCommandQueue>> commandQueues;
-    std::set<std::unique_ptr<OpenCLBuffer>> buffers;
-    std::set<std::unique_ptr<OpenCLBuffer>> persistentBuffers;
-    std::map<std::pair<std::string, std::string>, std::pair<std::unique_ptr<OpenCLKernel>, std::unique_ptr<OpenCLProgram>>> kernelCache;
+    DeviceMemoryPool<cl_mem> bufferPool;
+    std::unordered_map<ArgumentId, std::unique_ptr<OpenCLBuffer>> buffers;
+    std::unordered_map<ArgumentId, std::unique_ptr<OpenCLBuffer>> persistentBuffers;
+    std::unordered_map<ArgumentId, std::pair<uint64_t, std::unique_ptr<OpenCLBuffer>>> argumentSnapshots;
+    KernelCache<std::pair<std::unique_ptr<OpenCLKernel>, std::unique_ptr<OpenCLProgram>>> kernelCache;
+    std::map<std::pair<std::string, std::string>, std::future<std::unique_ptr<OpenCLProgram>>> pendingPrograms;
+    std::deque<std::pair<std::string, std::string>> speculativePrograms;
+    mutable ProgramBinaryCache binaryCache;
+    std::string binaryCacheIdentity;
+    mutable CompilationFailureCache failureCache;
     mutable std::map<EventId, std::unique_ptr<OpenCLEvent>> kernelEvents;
     mutable std::map<EventId, std::unique_ptr<OpenCLEvent>> bufferEvents;
+    mutable DeviceMemoryPool<OpenCLStagingBuffer> stagingPool;
+    mutable std::map<EventId, std::pair<OpenCLStagingBuffer, uint64_t>> stagingBuffers;
 
     #if defined(KTT_PROFILING_GPA) || defined(KTT_PROFILING_GPA_LEGACY)
     std::unique_ptr<GPAInterface> gpaInterface;
@@ -116,18 +146,31 @@ private:
     std::map<std::pair<std::string, std::string>, std::unique_ptr<GPAProfilingInstance>> kernelProfilingInstances;
     #endif // KTT_PROFILING_GPA || KTT_PROFILING_GPA_LEGACY
 
+    // Declared last, so that background compilation is stopped before the context is released
+    ThreadPool compilationPool;
+
     // Helper methods
     void setKernelArgument(OpenCLKernel& kernel, KernelArgument& argument);
     void setKernelArgument(OpenCLKernel& kernel, KernelArgument& argument, const std::vector<LocalMemoryModifier>& modifiers);
     EventId enqueueKernel(OpenCLKernel& kernel, const std::vector<size_t>& globalSize, const std::vector<size_t>& localSize,
         const QueueId queue, const uint64_t kernelLaunchOverhead) const;
     KernelResult createKernelResult(const EventId id) const;
+    OpenCLKernel* loadKernelFromCache(const KernelRuntimeData& kernelData);
+    std::string getProgramOptions(const KernelRuntimeData& kernelData) const;
+    std::unique_ptr<OpenCLProgram> buildProgram(const std::string& source, const std::string& options) const;
+    std::future<std::unique_ptr<OpenCLProgram>> buildProgramAsync(const std::string& source, const std::string& options, const bool lowPriority);
     static PlatformInfo getOpenCLPlatformInfo(const PlatformIndex platform);
     static DeviceInfo getOpenCLDeviceInfo(const PlatformIndex platform, const DeviceIndex device);
     static std::vector<OpenCLPlatform> getOpenCLPlatforms();
     static std::vector<OpenCLDevice> getOpenCLDevices(const OpenCLPlatform& platform);
     static DeviceType getDeviceType(const cl_device_type deviceType);
     OpenCLBuffer* findBuffer(const ArgumentId id) const;
+    const OpenCLBuffer* findArgumentSnapshot(const KernelArgument& kernelArgument);
+    void createArgumentSnapshot(KernelArgument& kernelArgument, const OpenCLBuffer& buffer, const QueueId queue);
+    const void* getUploadSource(const EventId id, const OpenCLBuffer& buffer, const void* data, const size_t dataSize);
+    uint64_t downloadThroughStagingBuffer(const OpenCLBuffer& buffer, void* destination, const size_t dataSize) const;
+    OpenCLStagingBuffer acquireStagingBuffer(const size_t dataSize) const;
+    uint64_t releaseStagingBuffer(const EventId id) const;
     void setKernelArgumentVector(OpenCLKernel& kernel, const OpenCLBuffer& buffer) const;
     bool loadBufferFromCache(const ArgumentId id, OpenCLKernel& kernel) const;
     void checkLocalMemoryModifiers(const std::vector<KernelArgument*>& argumentPointers, const std::vector<LocalMemoryModifier>& modifiers) const;
@@ -14,7 +14,8 @@ public:
     explicit OpenCLProgram(const std::string& source, const cl_context context, const std::vector<cl_device_id>& devices) :
         source(source),
         context(context),
-        devices(devices)
+        devices(devices),
+        buildResult(CL_SUCCESS)
     {
         cl_int result;
         size_t sourceLength = source.size();
@@ -23,6 +24,22 @@ public:
         checkOpenCLError(result, "clCreateProgramWithSource");
     }
 
+    explicit OpenCLProgram(const std::string& source, const std::string& binary, const cl_context context,
+        const std::vector<cl_device_id>& devices) :
+        source(source),
+        context(context),
+        devices(devices),
+        buildResult(CL_SUCCESS)
+    {
+        cl_int result;
+        cl_int binaryStatus;
+        size_t binaryLength = binary.size();
+        auto binaryPointer = reinterpret_cast<const unsigned char*>(binary.data());
+        program = clCreateProgramWithBinary(context, 1, &devices.at(0), &binaryLength, &binaryPointer, &binaryStatus, &result);
+        checkOpenCLError(result, "clCreateProgramWithBinary");
+        checkOpenCLError(binaryStatus, "clCreateProgramWithBinary");
+    }
+
     ~OpenCLProgram()
     {
         checkOpenCLError(clReleaseProgram(program), "clReleaseProgram");
@@ -31,6 +48,7 @@ public:
     void build(const std::string& compilerOptions)
     {
         cl_int result = clBuildProgram(program, static_cast<cl_uint>(devices.size()), &devices.at(0), &compilerOptions[0], nullptr, nullptr);
+        buildResult = result;
         std::string buildInfo = getBuildInfo();
         checkOpenCLError(result, buildInfo);
     }
@@ -50,6 +68,37 @@ public:
         return infoString;
     }
 
+    // Distinguishes errors reported by compiler from other build errors, eg. lack of resources
+    bool hasCompilationError() const
+    {
+        return buildResult == CL_BUILD_PROGRAM_FAILURE;
+    }
+
+    // Returns binary for the first device, programs are always built for single device
+    std::string getBinary() const
+    {
+        std::vector<size_t> binarySizes(devices.size());
+        checkOpenCLError(clGetProgramInfo(program, CL_PROGRAM_BINARY_SIZES, binarySizes.size() * sizeof(size_t), binarySizes.data(), nullptr),
+            "clGetProgramInfo");
+
+        std::vector<std::string> binaries;
+        std::vector<unsigned char*> binaryPointers;
+
+        for (const auto binarySize : binarySizes)
+        {
+            binaries.emplace_back(binarySize, '\0');
+        }
+
+        for (auto& binary : binaries)
+        {
+            binaryPointers.push_back(reinterpret_cast<unsigned char*>(&binary[0]));
+        }
+
+        checkOpenCLError(clGetProgramInfo(program, CL_PROGRAM_BINARIES, binaryPointers.size() * sizeof(unsigned char*), binaryPointers.data(),
+            nullptr), "clGetProgramInfo");
+        return binaries.at(0);
+    }
+
     cl_context getContext() const
     {
         return context;
@@ -75,6 +124,7 @@ private:
     cl_context context;
     std::vector<cl_device_id> devices;
     cl_program program;
+    cl_int buildResult;
 };
 
 } // namespace ktt
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <CL/cl.h>
+
+namespace ktt
+{
+
+// Host memory allocated by OpenCL runtime and kept mapped for the whole lifetime of the buffer, such memory is page-locked by most drivers,
+// so transfers between it and device buffers do not have to be staged through additional driver-side buffers
+struct OpenCLStagingBuffer
+{
+    cl_mem buffer;
+    void* data;
+    size_t size;
+};
+
+} // namespace ktt
@@ -0,0 +1,374 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <compute_engine/program_binary_cache.h>
+#include <utility/ktt_utility.h>
+#include <utility/logger.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+namespace ktt
+{
+
+const std::string indexFileName = "ktt_program_cache.index";
+const std::string lockFileName = "ktt_program_cache.lock";
+const size_t lockAttempts = 1000;
+
+namespace
+{
+
+// Advisory lock on the lock file, which is released by the operating system if the process terminates without releasing it
+class DirectoryLock
+{
+public:
+    explicit DirectoryLock(const std::string& path) :
+    #ifdef _WIN32
+        file(INVALID_HANDLE_VALUE),
+    #else
+        file(-1),
+    #endif
+        acquired(false)
+    {
+    #ifdef _WIN32
+        file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+            OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        for (size_t attempt = 0; file != INVALID_HANDLE_VALUE && attempt < lockAttempts && !acquired; ++attempt)
+        {
+            OVERLAPPED overlapped = {};
+            acquired = LockFileEx(file, LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY, 0, 1, 0, &overlapped) != 0;
+
+            if (!acquired)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+    #else
+        file = open(path.c_str(), O_RDWR | O_CREAT, 0666);
+
+        for (size_t attempt = 0; file != -1 && attempt < lockAttempts && !acquired; ++attempt)
+        {
+            acquired = flock(file, LOCK_EX | LOCK_NB) == 0;
+
+            if (!acquired)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+    #endif
+
+        if (!acquired)
+        {
+            Logger::logWarning(std::string("Unable to lock program cache directory, cache is not used for this operation, lock file: ")
+                + path);
+        }
+    }
+
+    ~DirectoryLock()
+    {
+        // Lock file is not removed, another process could already be waiting for a lock on it
+    #ifdef _WIN32
+        if (file != INVALID_HANDLE_VALUE)
+        {
+            if (acquired)
+            {
+                OVERLAPPED overlapped = {};
+                UnlockFileEx(file, 0, 1, 0, &overlapped);
+            }
+            CloseHandle(file);
+        }
+    #else
+        if (file != -1)
+        {
+            if (acquired)
+            {
+                flock(file, LOCK_UN);
+            }
+            close(file);
+        }
+    #endif
+    }
+
+    DirectoryLock(const DirectoryLock&) = delete;
+    DirectoryLock& operator=(const DirectoryLock&) = delete;
+
+    bool isLocked() const
+    {
+        return acquired;
+    }
+
+private:
+#ifdef _WIN32
+    HANDLE file;
+#else
+    int file;
+#endif
+    bool acquired;
+};
+
+} // namespace
+
+ProgramBinaryCache::ProgramBinaryCache() :
+    directory(""),
+    maximumSize(0),
+    useCounter(0)
+{}
+
+void ProgramBinaryCache::setDirectory(const std::string& directory, const size_t maximumSize)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    this->directory = directory;
+    this->maximumSize = maximumSize;
+    entries.clear();
+    useCounter = 0;
+
+    if (directory.empty())
+    {
+        return;
+    }
+
+    const DirectoryLock directoryLock(getPath(lockFileName));
+
+    if (!directoryLock.isLocked())
+    {
+        return;
+    }
+
+    mergeIndex();
+    evictEntries();
+    saveIndex();
+}
+
+bool ProgramBinaryCache::isEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return !directory.empty();
+}
+
+bool ProgramBinaryCache::load(const std::string& key, std::string& binary)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (directory.empty())
+    {
+        return false;
+    }
+
+    const DirectoryLock directoryLock(getPath(lockFileName));
+
+    if (!directoryLock.isLocked())
+    {
+        return false;
+    }
+
+    mergeIndex();
+    const std::string fileName = getFileName(key);
+    auto entryPointer = entries.find(fileName);
+
+    if (entryPointer == entries.end())
+    {
+        return false;
+    }
+
+    std::ifstream inputStream(getPath(fileName), std::ios::binary);
+    std::string header;
+
+    // File could have been removed or its digest collides with different key
+    if (!inputStream.is_open() || !std::getline(inputStream, header) || header != getHeader(key))
+    {
+        inputStream.close();
+        removeEntry(fileName);
+        saveIndex();
+        return false;
+    }
+
+    // Index is not rewritten on a hit, the use is written with the next modification of the index
+    binary.assign(std::istreambuf_iterator<char>(inputStream), std::istreambuf_iterator<char>());
+    entryPointer->second.lastUse = ++useCounter;
+    return true;
+}
+
+void ProgramBinaryCache::store(const std::string& key, const std::string& binary)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (directory.empty() || binary.size() > maximumSize)
+    {
+        return;
+    }
+
+    const DirectoryLock directoryLock(getPath(lockFileName));
+
+    if (!directoryLock.isLocked())
+    {
+        return;
+    }
+
+    mergeIndex();
+
+    // Entry is recorded before the file is written, so that a file left behind by a terminated process still counts towards the size limit
+    const std::string fileName = getFileName(key);
+    entries[fileName] = Entry{static_cast<uint64_t>(binary.size()), ++useCounter};
+    evictEntries();
+    saveIndex();
+
+    std::ofstream outputStream(getPath(fileName), std::ios::binary | std::ios::trunc);
+
+    if (!outputStream.is_open())
+    {
+        Logger::logWarning(std::string("Unable to write compiled program to cache directory ") + directory);
+        removeEntry(fileName);
+        saveIndex();
+        return;
+    }
+
+    outputStream << getHeader(key) << '\n';
+    outputStream.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+}
+
+void ProgramBinaryCache::remove(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (directory.empty())
+    {
+        return;
+    }
+
+    const DirectoryLock directoryLock(getPath(lockFileName));
+
+    if (!directoryLock.isLocked())
+    {
+        return;
+    }
+
+    mergeIndex();
+
+    if (entries.find(getFileName(key)) == entries.end())
+    {
+        return;
+    }
+
+    removeEntry(getFileName(key));
+    saveIndex();
+}
+
+void ProgramBinaryCache::mergeIndex()
+{
+    // Entries missing from the index were removed by another process, uses recorded by this process are kept
+    std::map<std::string, Entry> indexEntries;
+    std::ifstream inputStream(getPath(indexFileName));
+    std::string line;
+
+    while (std::getline(inputStream, line))
+    {
+        std::stringstream lineStream(line);
+        std::string fileName;
+        Entry entry;
+
+        if (lineStream >> fileName >> entry.size >> entry.lastUse)
+        {
+            auto localEntry = entries.find(fileName);
+
+            if (localEntry != entries.end())
+            {
+                entry.lastUse = std::max(entry.lastUse, localEntry->second.lastUse);
+            }
+
+            indexEntries[fileName] = entry;
+            useCounter = std::max(useCounter, entry.lastUse);
+        }
+    }
+
+    entries = std::move(indexEntries);
+}
+
+void ProgramBinaryCache::saveIndex() const
+{
+    // Index is written into temporary file first, so that it is never left partially written
+    const std::string indexPath = getPath(indexFileName);
+    const std::string temporaryPath = indexPath + ".tmp";
+
+    {
+        std::ofstream outputStream(temporaryPath, std::ios::trunc);
+
+        for (const auto& entry : entries)
+        {
+            outputStream << entry.first << " " << entry.second.size << " " << entry.second.lastUse << std::endl;
+        }
+    }
+
+    // Rename does not replace existing file on Windows
+    if (std::rename(temporaryPath.c_str(), indexPath.c_str()) != 0)
+    {
+        std::remove(indexPath.c_str());
+        std::rename(temporaryPath.c_str(), indexPath.c_str());
+    }
+}
+
+void ProgramBinaryCache::evictEntries()
+{
+    uint64_t totalSize = 0;
+
+    for (const auto& entry : entries)
+    {
+        totalSize += entry.second.size;
+    }
+
+    // The least recently used programs are evicted first
+    while (totalSize > maximumSize && !entries.empty())
+    {
+        auto oldestEntry = std::min_element(entries.cbegin(), entries.cend(), [](const auto& first, const auto& second)
+        {
+            return first.second.lastUse < second.second.lastUse;
+        });
+
+        totalSize -= oldestEntry->second.size;
+        removeEntry(oldestEntry->first);
+    }
+}
+
+void ProgramBinaryCache::removeEntry(const std::string& fileName)
+{
+    std::remove(getPath(fileName).c_str());
+    entries.erase(fileName);
+}
+
+std::string ProgramBinaryCache::getPath(const std::string& fileName) const
+{
+    const char lastCharacter = directory.back();
+
+    if (lastCharacter == '/' || lastCharacter == '\\')
+    {
+        return directory + fileName;
+    }
+
+    return directory + "/" + fileName;
+}
+
+std::string ProgramBinaryCache::getFileName(const std::string& key)
+{
+    return getHexString(getFnvHash(key)) + ".bin";
+}
+
+std::string ProgramBinaryCache::getHeader(const std::string& key)
+{
+    // Second digest with different initial value makes accidental collision of both digests negligible
+    return std::string("KTT ") + getHexString(getFnvHash(key, getFnvHash(indexFileName)));
+}
+
+} // namespace ktt
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace ktt
+{
+
+// Persistent cache of compiled programs stored inside user-specified directory, shared between processes. Methods are thread-safe, so that
+// the cache can be used by background compilation threads. Processes serialize access to the directory with a lock file and re-read the index
+// before each access, uses of cached programs are kept in memory and written together with the next modification of the index.
+class ProgramBinaryCache
+{
+public:
+    ProgramBinaryCache();
+
+    void setDirectory(const std::string& directory, const size_t maximumSize);
+    bool isEnabled() const;
+    bool load(const std::string& key, std::string& binary);
+    void store(const std::string& key, const std::string& binary);
+    void remove(const std::string& key);
+
+private:
+    struct Entry
+    {
+        uint64_t size;
+        uint64_t lastUse;
+    };
+
+    std::string directory;
+    size_t maximumSize;
+    uint64_t useCounter;
+    std::map<std::string, Entry> entries;
+    mutable std::mutex mutex;
+
+    void mergeIndex();
+    void saveIndex() const;
+    void evictEntries();
+    void removeEntry(const std::string& fileName);
+    std::string getPath(const std::string& fileName) const;
+    static std::string getFileName(const std::string& key);
+    static std::string getHeader(const std::string& key);
+};
+
+} // namespace ktt
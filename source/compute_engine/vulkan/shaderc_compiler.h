@@ -9,6 +9,15 @@
 namespace ktt
 {
 
+// Shader was rejected by compiler diagnostics, other compiler errors are reported with std::runtime_error
+class ShaderCompilationError : public std::runtime_error
+{
+public:
+    explicit ShaderCompilationError(const std::string& message) :
+        std::runtime_error(message)
+    {}
+};
+
 class ShadercCompiler
 {
 public:
@@ -52,10 +61,7 @@ private:
     {
         shaderc::PreprocessedSourceCompilationResult result = compiler.PreprocessGlsl(source, kind, name.c_str(), options);
 
-        if (result.GetCompilationStatus() != shaderc_compilation_status_success)
-        {
-            throw std::runtime_error(std::string("Vulkan shader compiler error: ") + result.GetErrorMessage());
-        }
+        checkCompilationStatus(result.GetCompilationStatus(), result.GetErrorMessage());
 
         return std::string{result.cbegin(), result.cend()};
     }
@@ -65,10 +71,7 @@ private:
     {
         shaderc::SpvCompilationResult binaryModule = compiler.CompileGlslToSpv(source, kind, name.c_str(), options);
 
-        if (binaryModule.GetCompilationStatus() != shaderc_compilation_status_success)
-        {
-            throw std::runtime_error(std::string("Vulkan shader compiler error: ") + binaryModule.GetErrorMessage());
-        }
+        checkCompilationStatus(binaryModule.GetCompilationStatus(), binaryModule.GetErrorMessage());
 
         return std::vector<uint32_t>{binaryModule.cbegin(), binaryModule.cend()};
     }
@@ -78,12 +81,22 @@ private:
     {
         shaderc::AssemblyCompilationResult assembly = compiler.CompileGlslToSpvAssembly(source, kind, name.c_str(), options);
 
-        if (assembly.GetCompilationStatus() != shaderc_compilation_status_success)
+        checkCompilationStatus(assembly.GetCompilationStatus(), assembly.GetErrorMessage());
+
+        return std::string{assembly.cbegin(), assembly.cend()};
+    }
+
+    static void checkCompilationStatus(const shaderc_compilation_status status, const std::string& errorMessage)
+    {
+        if (status == shaderc_compilation_status_compilation_error)
         {
-            throw std::runtime_error(std::string("Vulkan shader compiler error: ") + assembly.GetErrorMessage());
+            throw ShaderCompilationError(std::string("Vulkan shader compiler error: ") + errorMessage);
         }
 
-        return std::string{assembly.cbegin(), assembly.cend()};
+        if (status != shaderc_compilation_status_success)
+        {
+            throw std::runtime_error(std::string("Vulkan shader compiler error: ") + errorMessage);
+        }
     }
 
     static void addParameterDefinitions(shaderc::CompileOptions& options, const std::vector<ParameterPair>& parameterPairs)
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <cstring>
 #include <vulkan/vulkan.h>
 #include <compute_engine/vulkan/vulkan_physical_device.h>
@@ -23,7 +25,8 @@ public:
         kernelArgumentId(source.getKernelArgumentId()),
         dataType(source.getDataType()),
         memoryLocation(ArgumentMemoryLocation::Host),
-        accessType(source.getAccessType())
+        accessType(source.getAccessType()),
+        generation(getNextGeneration())
     {
         const VkBufferCreateInfo bufferCreateInfo =
         {
@@ -51,7 +54,8 @@ public:
         kernelArgumentId(kernelArgument.getId()),
         dataType(kernelArgument.getDataType()),
         memoryLocation(kernelArgument.getMemoryLocation()),
-        accessType(kernelArgument.getAccessType())
+        accessType(kernelArgument.getAccessType()),
+        generation(getNextGeneration())
     {
         const VkBufferCreateInfo bufferCreateInfo =
         {
@@ -190,6 +194,12 @@ public:
         return accessType;
     }
 
+    // Unique for each created buffer, unlike buffer handle which can be reused after the buffer is destroyed
+    uint64_t getGeneration() const
+    {
+        return generation;
+    }
+
 private:
     VkDevice device;
     const VulkanPhysicalDevice* physicalDevice;
@@ -202,6 +212,13 @@ private:
     ArgumentDataType dataType;
     ArgumentMemoryLocation memoryLocation;
     ArgumentAccessType accessType;
+    uint64_t generation;
+
+    static uint64_t getNextGeneration()
+    {
+        static std::atomic<uint64_t> nextGeneration(0);
+        return nextGeneration++;
+    }
 };
 
 } // namespace ktt
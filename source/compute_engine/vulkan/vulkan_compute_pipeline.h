@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <vulkan/vulkan.h>
@@ -26,8 +27,8 @@ public:
         descriptorSets(nullptr)
     {}
 
-    explicit VulkanComputePipeline(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, VkShaderModule shader,
-        const std::string& shaderName, const VulkanPushConstant& pushConstant) :
+    explicit VulkanComputePipeline(VkDevice device, VkPipelineCache pipelineCache, VkDescriptorSetLayout descriptorSetLayout, VkShaderModule shader,
+        const std::string& shaderName, const VulkanPushConstant& pushConstant, const VkSpecializationInfo* specializationInfo = nullptr) :
         device(device),
         descriptorSetLayout(descriptorSetLayout),
         shaderName(shaderName),
@@ -55,7 +56,7 @@ public:
             VK_SHADER_STAGE_COMPUTE_BIT,
             shader,
             shaderName.c_str(),
-            nullptr
+            specializationInfo
         };
 
         const VkComputePipelineCreateInfo pipelineCreateInfo =
@@ -69,7 +70,7 @@ public:
             0
         };
 
-        checkVulkanError(vkCreateComputePipelines(device, nullptr, 1, &pipelineCreateInfo, nullptr, &pipeline), "vkCreateComputePipelines");
+        checkVulkanError(vkCreateComputePipelines(device, pipelineCache, 1, &pipelineCreateInfo, nullptr, &pipeline), "vkCreateComputePipelines");
     }
 
     ~VulkanComputePipeline()
@@ -111,12 +112,27 @@ public:
             descriptorPool.reset(nullptr);
             descriptorPool = std::make_unique<VulkanDescriptorPool>(device, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, descriptorCount);
             descriptorSets = std::make_unique<VulkanDescriptorSetHolder>(device, descriptorPool->getDescriptorPool(), descriptorSetLayout);
+            boundGenerations.clear();
+        }
+
+        std::vector<VkDescriptorBufferInfo> bufferInfos;
+        std::vector<uint64_t> generations;
+
+        for (const auto* buffer : buffers)
+        {
+            bufferInfos.push_back(VkDescriptorBufferInfo{buffer->getBuffer(), 0, buffer->getBufferSize()});
+            generations.push_back(buffer->getGeneration());
         }
 
-        for (size_t i = 0; i < buffers.size(); ++i)
+        // Descriptor set is reused between launches, so it only needs to be updated when different buffers are used. Buffers are compared by
+        // generation, handle of a destroyed buffer can be reused by a new one.
+        if (generations == boundGenerations)
         {
-            descriptorSets->bindBuffer(*buffers[i], VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 0, static_cast<uint32_t>(i));
+            return;
         }
+
+        descriptorSets->bindBuffers(bufferInfos, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 0);
+        boundGenerations = generations;
     }
 
     void recordDispatchShaderCommand(VkCommandBuffer commandBuffer, const std::vector<size_t>& globalSize, const VulkanPushConstant& pushConstant,
@@ -161,6 +177,7 @@ private:
     std::string shaderName;
     std::unique_ptr<VulkanDescriptorPool> descriptorPool;
     std::unique_ptr<VulkanDescriptorSetHolder> descriptorSets;
+    std::vector<uint64_t> boundGenerations;
 };
 
 } // namespace ktt
@@ -89,6 +89,38 @@ public:
         vkUpdateDescriptorSets(device, 1, &descriptorWrite, 0, nullptr);
     }
 
+    // Binds buffers to consecutive bindings starting from zero with a single descriptor update
+    void bindBuffers(const std::vector<VkDescriptorBufferInfo>& bufferInfos, const VkDescriptorType descriptorType, const size_t descriptorSetIndex)
+    {
+        if (descriptorSets.size() <= static_cast<size_t>(descriptorSetIndex))
+        {
+            throw std::runtime_error("Descriptor set index is out of range for this descriptor set holder");
+        }
+
+        std::vector<VkWriteDescriptorSet> descriptorWrites;
+
+        for (size_t i = 0; i < bufferInfos.size(); ++i)
+        {
+            const VkWriteDescriptorSet descriptorWrite =
+            {
+                VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                nullptr,
+                descriptorSets[descriptorSetIndex],
+                static_cast<uint32_t>(i),
+                0,
+                1,
+                descriptorType,
+                nullptr,
+                &bufferInfos[i],
+                nullptr
+            };
+
+            descriptorWrites.push_back(descriptorWrite);
+        }
+
+        vkUpdateDescriptorSets(device, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+    }
+
 private:
     VkDevice device;
     std::vector<VkDescriptorSet> descriptorSets;
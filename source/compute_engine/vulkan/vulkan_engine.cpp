@@ -1,5 +1,7 @@
 #ifdef KTT_PLATFORM_VULKAN
 
+#include <algorithm>
+#include <cstring>
 #include <limits>
 #include <compute_engine/vulkan/vulkan_engine.h>
 #include <utility/ktt_utility.h>
@@ -15,9 +17,14 @@ VulkanEngine::VulkanEngine(const DeviceIndex deviceIndex, const uint32_t queueCo
     globalSizeType(GlobalSizeType::Vulkan),
     globalSizeCorrection(false),
     kernelCacheFlag(true),
-    kernelCacheCapacity(10),
+    specializationConstantFlag(false),
+    speculativeCacheCapacity(0),
     persistentBufferFlag(true),
-    nextEventId(0)
+    nextEventId(0),
+    pipelineCache(10),
+    shaderCache(10),
+    failureCache(binaryCache),
+    compilationPool(ThreadPool::getHardwareThreadCount())
 {
     std::vector<const char*> instanceExtensions;
     std::vector<const char*> validationLayers;
@@ -40,11 +47,25 @@ VulkanEngine::VulkanEngine(const DeviceIndex deviceIndex, const uint32_t queueCo
     device = std::make_unique<VulkanDevice>(devices.at(deviceIndex), queueCount, VK_QUEUE_COMPUTE_BIT, std::vector<const char*>{}, validationLayers);
     queues = device->getQueues();
 
+    // Compiled shaders are kept separately for each device and driver, the same way as for other compute APIs
+    const VkPhysicalDeviceProperties properties = devices.at(deviceIndex).getProperties();
+    binaryCacheIdentity = std::string(properties.deviceName) + "\n" + std::to_string(properties.driverVersion) + "\n";
+
+    // Command buffers are reset and reused between operations instead of being allocated for each of them
     Logger::logDebug("Initializing Vulkan command pool");
-    commandPool = std::make_unique<VulkanCommandPool>(device->getDevice(), device->getQueueFamilyIndex());
+    commandPool = std::make_unique<VulkanCommandPool>(device->getDevice(), device->getQueueFamilyIndex(),
+        VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
 
     Logger::logDebug("Initializing Vulkan query pool");
     queryPool = std::make_unique<VulkanQueryPool>(device->getDevice(), devices.at(deviceIndex).getProperties().limits.timestampPeriod);
+
+    Logger::logDebug("Initializing Vulkan pipeline cache");
+    driverPipelineCache = std::make_unique<VulkanPipelineCache>(device->getDevice());
+}
+
+VulkanEngine::~VulkanEngine()
+{
+    storePipelineCache();
 }
 
 KernelResult VulkanEngine::runKernel(const KernelRuntimeData& kernelData, const std::vector<KernelArgument*>& argumentPointers,
@@ -63,39 +84,36 @@ EventId VulkanEngine::runKernelAsync(const KernelRuntimeData& kernelData, const
     VulkanComputePipeline* pipeline;
     std::unique_ptr<VulkanComputePipeline> pipelineUnique;
     std::unique_ptr<VulkanDescriptorSetLayout> layout;
-    std::unique_ptr<VulkanShaderModule> shader;
+    std::shared_ptr<VulkanShaderModule> shader;
 
     std::vector<VulkanBuffer*> pipelineArguments = getPipelineArguments(argumentPointers);
     const uint32_t bindingCount = static_cast<uint32_t>(pipelineArguments.size());
     std::vector<KernelArgument*> scalarArguments = getScalarArguments(argumentPointers);
     VulkanPushConstant pushConstant(scalarArguments);
+    VulkanSpecializationInfo specialization(specializationConstantFlag ? kernelData.getParameterPairs() : std::vector<ParameterPair>{});
+    const VkSpecializationInfo* specializationInfo = specializationConstantFlag ? &specialization.specializationInfo : nullptr;
 
     if (kernelCacheFlag)
     {
-        if (pipelineCache.find(std::make_pair(kernelData.getName(), kernelData.getSource())) == pipelineCache.end())
+        auto cachedEntry = pipelineCache.find(kernelData.getProgramName(), kernelData.getSource());
+
+        if (cachedEntry == nullptr)
         {
-            if (pipelineCache.size() >= kernelCacheCapacity)
-            {
-                clearKernelCache();
-            }
             auto cacheLayout = std::make_unique<VulkanDescriptorSetLayout>(device->getDevice(), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, bindingCount);
-            auto cacheShader = std::make_unique<VulkanShaderModule>(device->getDevice(), kernelData.getName(), kernelData.getUnmodifiedSource(),
-                kernelData.getLocalSize(), kernelData.getParameterPairs());
-            auto cachePipeline = std::make_unique<VulkanComputePipeline>(device->getDevice(), cacheLayout->getDescriptorSetLayout(),
-                cacheShader->getShaderModule(), kernelData.getName(), pushConstant);
+            auto cacheShader = getShaderModule(kernelData);
+            auto cachePipeline = std::make_unique<VulkanComputePipeline>(device->getDevice(), driverPipelineCache->getPipelineCache(),
+                cacheLayout->getDescriptorSetLayout(), cacheShader->getShaderModule(), kernelData.getName(), pushConstant, specializationInfo);
             auto cacheEntry = std::make_unique<VulkanPipelineCacheEntry>(std::move(cachePipeline), std::move(cacheLayout), std::move(cacheShader));
-            pipelineCache.insert(std::make_pair(std::make_pair(kernelData.getName(), kernelData.getSource()), std::move(cacheEntry)));
+            cachedEntry = &pipelineCache.insert(kernelData.getProgramName(), kernelData.getSource(), std::move(cacheEntry));
         }
-        auto cachePointer = pipelineCache.find(std::make_pair(kernelData.getName(), kernelData.getSource()));
-        pipeline = cachePointer->second->pipeline.get();
+        pipeline = (*cachedEntry)->pipeline.get();
     }
     else
     {
         layout = std::make_unique<VulkanDescriptorSetLayout>(device->getDevice(), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, bindingCount);
-        shader = std::make_unique<VulkanShaderModule>(device->getDevice(), kernelData.getName(), kernelData.getUnmodifiedSource(),
-            kernelData.getLocalSize(), kernelData.getParameterPairs());
-        pipelineUnique = std::make_unique<VulkanComputePipeline>(device->getDevice(), layout->getDescriptorSetLayout(), shader->getShaderModule(),
-            kernelData.getName(), pushConstant);
+        shader = getShaderModule(kernelData);
+        pipelineUnique = std::make_unique<VulkanComputePipeline>(device->getDevice(), driverPipelineCache->getPipelineCache(),
+            layout->getDescriptorSetLayout(), shader->getShaderModule(), kernelData.getName(), pushConstant, specializationInfo);
         pipeline = pipelineUnique.get();
     }
 
@@ -130,11 +148,62 @@ uint64_t VulkanEngine::getKernelOverhead(const EventId id) const
     return eventPointer->second->getOverhead();
 }
 
+void VulkanEngine::precompileKernel(const KernelRuntimeData& kernelData, const bool speculative)
+{
+    const auto key = std::make_pair(kernelData.getProgramName(), getShaderKey(kernelData));
+
+    if (!kernelCacheFlag || pipelineCache.contains(kernelData.getProgramName(), kernelData.getSource())
+        || (specializationConstantFlag && shaderCache.contains(key.first, key.second)))
+    {
+        return;
+    }
+
+    if (pendingShaders.find(key) != pendingShaders.end())
+    {
+        if (!speculative)
+        {
+            // Shader is going to be used for sure, so it is no longer subject to speculative cache capacity
+            speculativeShaders.erase(std::remove(speculativeShaders.begin(), speculativeShaders.end(), key), speculativeShaders.end());
+        }
+        return;
+    }
+
+    if (speculative && speculativeCacheCapacity == 0)
+    {
+        return;
+    }
+
+    // Compute pipeline depends on argument bindings and push constants, which are only known once the kernel is launched, so only
+    // compilation to SPIR-V is performed in background
+    pendingShaders.insert(std::make_pair(key, compileShaderAsync(kernelData, speculative)));
+
+    if (speculative)
+    {
+        speculativeShaders.push_back(key);
+
+        if (speculativeShaders.size() > speculativeCacheCapacity)
+        {
+            pendingShaders.erase(speculativeShaders.front());
+            speculativeShaders.pop_front();
+        }
+    }
+}
+
 void VulkanEngine::setCompilerOptions(const std::string& options)
 {
     compilerOptions = options;
 }
 
+void VulkanEngine::setSpecializationConstantUsage(const bool flag)
+{
+    if (flag != specializationConstantFlag)
+    {
+        // Cached shaders and pipelines were created with parameters passed the other way
+        clearKernelCache();
+    }
+    specializationConstantFlag = flag;
+}
+
 void VulkanEngine::setGlobalSizeType(const GlobalSizeType type)
 {
     globalSizeType = type;
@@ -156,12 +225,50 @@ void VulkanEngine::setKernelCacheUsage(const bool flag)
 
 void VulkanEngine::setKernelCacheCapacity(const size_t capacity)
 {
-    kernelCacheCapacity = capacity;
+    pipelineCache.setCapacity(capacity);
+    shaderCache.setCapacity(capacity);
 }
 
 void VulkanEngine::clearKernelCache()
 {
     pipelineCache.clear();
+    shaderCache.clear();
+    pendingShaders.clear();
+    speculativeShaders.clear();
+}
+
+KernelCacheStatistics VulkanEngine::getKernelCacheStatistics() const
+{
+    return pipelineCache.getStatistics();
+}
+
+void VulkanEngine::setPersistentKernelCache(const std::string& directory, const size_t maximumSize)
+{
+    storePipelineCache();
+    binaryCache.setDirectory(directory, maximumSize);
+    loadPipelineCache();
+}
+
+std::map<std::string, uint64_t> VulkanEngine::getCompilationFailureCauses() const
+{
+    return failureCache.getFailureCauses();
+}
+
+void VulkanEngine::setCompilationThreadCount(const size_t count)
+{
+    compilationPool.setThreadCount(count);
+}
+
+void VulkanEngine::setSpeculativeCacheCapacity(const size_t capacity)
+{
+    speculativeCacheCapacity = capacity;
+    compilationPool.setLowPriorityTaskLimit(capacity);
+
+    while (speculativeShaders.size() > speculativeCacheCapacity)
+    {
+        pendingShaders.erase(speculativeShaders.front());
+        speculativeShaders.pop_front();
+    }
 }
 
 QueueId VulkanEngine::getDefaultQueue() const
@@ -264,18 +371,18 @@ EventId VulkanEngine::uploadArgumentAsync(KernelArgument& kernelArgument, const
         deviceBuffer->allocateMemory(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 
         auto bufferEvent = std::make_unique<VulkanEvent>(device->getDevice(), eventId, true);
-        auto commandBuffer = std::make_unique<VulkanCommandBufferHolder>(device->getDevice(), commandPool->getCommandPool());
+        auto commandBuffer = acquireCommandBuffer();
         deviceBuffer->recordCopyDataCommand(commandBuffer->getCommandBuffer(), hostBuffer->getBuffer(), hostBuffer->getBufferSize());
         queues[queue].submitSingleCommand(commandBuffer->getCommandBuffer(), bufferEvent->getFence().getFence());
 
         bufferEvents.insert(std::make_pair(eventId, std::move(bufferEvent)));
         eventCommands.insert(std::make_pair(eventId, std::move(commandBuffer)));
         stagingBuffers.insert(std::make_pair(eventId, std::move(hostBuffer)));
-        buffers.insert(std::move(deviceBuffer));
+        buffers[kernelArgument.getId()] = std::move(deviceBuffer);
     }
     else if (kernelArgument.getMemoryLocation() == ArgumentMemoryLocation::Host)
     {
-        buffers.insert(std::move(hostBuffer));
+        buffers[kernelArgument.getId()] = std::move(hostBuffer);
     }
 
     ++nextEventId;
@@ -334,7 +441,7 @@ EventId VulkanEngine::downloadArgumentAsync(const ArgumentId id, void* destinati
         hostBuffer->allocateMemory(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
         auto bufferEvent = std::make_unique<VulkanEvent>(device->getDevice(), eventId, true);
-        auto commandBuffer = std::make_unique<VulkanCommandBufferHolder>(device->getDevice(), commandPool->getCommandPool());
+        auto commandBuffer = acquireCommandBuffer();
         hostBuffer->recordCopyDataCommand(commandBuffer->getCommandBuffer(), buffer->getBuffer(), actualDataSize);
         queues[queue].submitSingleCommand(commandBuffer->getCommandBuffer(), bufferEvent->getFence().getFence());
 
@@ -379,7 +486,7 @@ KernelArgument VulkanEngine::downloadArgumentObject(const ArgumentId id, uint64_
         hostBuffer->allocateMemory(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
         auto bufferEvent = std::make_unique<VulkanEvent>(device->getDevice(), eventId, true);
-        auto commandBuffer = std::make_unique<VulkanCommandBufferHolder>(device->getDevice(), commandPool->getCommandPool());
+        auto commandBuffer = acquireCommandBuffer();
         hostBuffer->recordCopyDataCommand(commandBuffer->getCommandBuffer(), buffer->getBuffer(), argument.getDataSizeInBytes());
         queues[getDefaultQueue()].submitSingleCommand(commandBuffer->getCommandBuffer(), bufferEvent->getFence().getFence());
 
@@ -437,13 +544,25 @@ uint64_t VulkanEngine::getArgumentOperationDuration(const EventId id) const
     Logger::logDebug("Performing buffer operation synchronization for event id: " + std::to_string(id));
     eventPointer->second->wait();
     bufferEvents.erase(id);
-    eventCommands.erase(id);
+    releaseCommandBuffer(id);
     stagingBuffers.erase(id);
 
     // todo: return correct duration
     return 0;
 }
 
+size_t VulkanEngine::getArgumentBufferSize(const ArgumentId id) const
+{
+    VulkanBuffer* buffer = findBuffer(id);
+
+    if (buffer == nullptr)
+    {
+        throw std::runtime_error(std::string("Buffer with following id was not found: ") + std::to_string(id));
+    }
+
+    return static_cast<size_t>(buffer->getBufferSize());
+}
+
 void VulkanEngine::resizeArgument(const ArgumentId id, const size_t newSize, const bool preserveData)
 {
     throw std::runtime_error("Vulkan API is not yet supported");
@@ -454,24 +573,24 @@ void VulkanEngine::setPersistentBufferUsage(const bool flag)
     persistentBufferFlag = flag;
 }
 
-void VulkanEngine::clearBuffer(const ArgumentId id)
+void VulkanEngine::setArgumentSnapshotUsage(const bool flag)
 {
-    auto iterator = buffers.cbegin();
-
-    while (iterator != buffers.cend())
+    if (flag)
     {
-        if (iterator->get()->getKernelArgumentId() == id)
-        {
-            buffers.erase(iterator);
-            return;
-        }
-        else
-        {
-            ++iterator;
-        }
+        throw std::runtime_error("Argument snapshots are not supported for Vulkan backend");
     }
 }
 
+void VulkanEngine::setPinnedStagingUsage(const bool)
+{
+    // Transfers between host and device local buffers are always staged through host visible buffers
+}
+
+void VulkanEngine::clearBuffer(const ArgumentId id)
+{
+    buffers.erase(id);
+}
+
 void VulkanEngine::clearBuffers()
 {
     buffers.clear();
@@ -483,7 +602,7 @@ void VulkanEngine::clearBuffers(const ArgumentAccessType accessType)
 
     while (iterator != buffers.cend())
     {
-        if (iterator->get()->getAccessType() == accessType)
+        if (iterator->second->getAccessType() == accessType)
         {
             iterator = buffers.erase(iterator);
         }
@@ -599,7 +718,7 @@ EventId VulkanEngine::enqueuePipeline(VulkanComputePipeline& pipeline, const std
     ++nextEventId;
 
     Logger::logDebug("Launching kernel " + pipeline.getShaderName() + ", event id: " + std::to_string(eventId));
-    auto command = std::make_unique<VulkanCommandBufferHolder>(device->getDevice(), commandPool->getCommandPool());
+    auto command = acquireCommandBuffer();
     pipeline.recordDispatchShaderCommand(command->getCommandBuffer(), correctedGlobalSize, pushConstant, queryPool->getQueryPool());
     queues[queue].submitSingleCommand(command->getCommandBuffer(), kernelEvent->getFence().getFence());
 
@@ -629,7 +748,228 @@ KernelResult VulkanEngine::createKernelResult(const EventId id) const
     result.setOverhead(overhead);
 
     kernelEvents.erase(id);
-    eventCommands.erase(id);
+    releaseCommandBuffer(id);
+
+    return result;
+}
+
+std::unique_ptr<VulkanCommandBufferHolder> VulkanEngine::acquireCommandBuffer() const
+{
+    if (freeCommandBuffers.empty())
+    {
+        return std::make_unique<VulkanCommandBufferHolder>(device->getDevice(), commandPool->getCommandPool());
+    }
+
+    // Command pool allows individual reset, so the buffer is implicitly reset once recording of a new command begins
+    std::unique_ptr<VulkanCommandBufferHolder> commandBuffer = std::move(freeCommandBuffers.back());
+    freeCommandBuffers.pop_back();
+    return commandBuffer;
+}
+
+void VulkanEngine::releaseCommandBuffer(const EventId id) const
+{
+    auto commandPointer = eventCommands.find(id);
+
+    if (commandPointer == eventCommands.end())
+    {
+        return;
+    }
+
+    // Only called after the corresponding fence was waited for, so the command buffer is no longer in use by device
+    freeCommandBuffers.push_back(std::move(commandPointer->second));
+    eventCommands.erase(commandPointer);
+}
+
+void VulkanEngine::loadPipelineCache()
+{
+    std::string data;
+
+    if (!binaryCache.isEnabled() || !binaryCache.load(binaryCacheIdentity + "Pipeline cache", data))
+    {
+        return;
+    }
+
+    // Pipelines created so far are preserved by merging the current cache into the loaded one
+    auto loadedCache = std::make_unique<VulkanPipelineCache>(device->getDevice(), data);
+    loadedCache->merge(*driverPipelineCache);
+    driverPipelineCache = std::move(loadedCache);
+}
+
+void VulkanEngine::storePipelineCache() const
+{
+    if (!binaryCache.isEnabled())
+    {
+        return;
+    }
+
+    try
+    {
+        binaryCache.store(binaryCacheIdentity + "Pipeline cache", driverPipelineCache->getData());
+    }
+    catch (const std::runtime_error& error)
+    {
+        Logger::logWarning(std::string("Unable to store Vulkan pipeline cache: ") + error.what());
+    }
+}
+
+std::vector<uint32_t> VulkanEngine::compileShader(const KernelRuntimeData& kernelData) const
+{
+    std::string binaryKey = binaryCacheIdentity + kernelData.getProgramName() + "\n";
+
+    for (const auto size : kernelData.getLocalSize())
+    {
+        binaryKey += std::to_string(size) + " ";
+    }
+
+    binaryKey += "\n" + getShaderKey(kernelData);
+
+    std::string failureMessage;
+    if (failureCache.find(binaryKey, failureMessage))
+    {
+        throw std::runtime_error(std::string("Compilation skipped, the same program failed to compile before: ") + failureMessage);
+    }
+
+    if (binaryCache.isEnabled())
+    {
+        std::string binary;
+        if (binaryCache.load(binaryKey, binary) && binary.size() % sizeof(uint32_t) == 0)
+        {
+            std::vector<uint32_t> spirvSource(binary.size() / sizeof(uint32_t));
+            std::memcpy(spirvSource.data(), binary.data(), binary.size());
+            return spirvSource;
+        }
+    }
+
+    std::vector<uint32_t> spirvSource;
+
+    try
+    {
+        spirvSource = ShadercCompiler::getCompiler().compile(kernelData.getName(), kernelData.getUnmodifiedSource(), shaderc_compute_shader,
+            kernelData.getLocalSize(), getShaderParameters(kernelData));
+    }
+    catch (const ShaderCompilationError& error)
+    {
+        failureCache.insert(binaryKey, error.what(), true);
+        throw;
+    }
+    catch (const std::runtime_error& error)
+    {
+        failureCache.insert(binaryKey, error.what(), false);
+        throw;
+    }
+
+    if (binaryCache.isEnabled())
+    {
+        binaryCache.store(binaryKey, std::string(reinterpret_cast<const char*>(spirvSource.data()), spirvSource.size() * sizeof(uint32_t)));
+    }
+
+    return spirvSource;
+}
+
+std::future<std::vector<uint32_t>> VulkanEngine::compileShaderAsync(const KernelRuntimeData& kernelData, const bool lowPriority)
+{
+    return compilationPool.enqueue([this, kernelData]()
+    {
+        return compileShader(kernelData);
+    }, lowPriority);
+}
+
+std::unique_ptr<VulkanShaderModule> VulkanEngine::loadShaderModule(const KernelRuntimeData& kernelData)
+{
+    const auto key = std::make_pair(kernelData.getProgramName(), getShaderKey(kernelData));
+    auto pendingPointer = pendingShaders.find(key);
+
+    if (pendingPointer == pendingShaders.end())
+    {
+        return std::make_unique<VulkanShaderModule>(device->getDevice(), kernelData.getName(), kernelData.getUnmodifiedSource(),
+            compileShader(kernelData));
+    }
+
+    std::future<std::vector<uint32_t>> pendingShader = std::move(pendingPointer->second);
+    pendingShaders.erase(pendingPointer);
+    speculativeShaders.erase(std::remove(speculativeShaders.begin(), speculativeShaders.end(), key), speculativeShaders.end());
+    std::vector<uint32_t> spirvSource;
+
+    // Errors from background compilation are rethrown here, the same way as if the shader was compiled synchronously
+    try
+    {
+        spirvSource = pendingShader.get();
+    }
+    catch (const std::future_error&)
+    {
+        // Speculative compilation was discarded by compilation pool before it started
+        return std::make_unique<VulkanShaderModule>(device->getDevice(), kernelData.getName(), kernelData.getUnmodifiedSource(),
+            compileShader(kernelData));
+    }
+
+    return std::make_unique<VulkanShaderModule>(device->getDevice(), kernelData.getName(), kernelData.getUnmodifiedSource(), spirvSource);
+}
+
+std::shared_ptr<VulkanShaderModule> VulkanEngine::getShaderModule(const KernelRuntimeData& kernelData)
+{
+    if (!kernelCacheFlag || !specializationConstantFlag)
+    {
+        return loadShaderModule(kernelData);
+    }
+
+    // Configurations which differ only in values of specialization constants share the same shader module
+    const std::string shaderKey = getShaderKey(kernelData);
+    auto cachedShader = shaderCache.find(kernelData.getProgramName(), shaderKey);
+
+    if (cachedShader != nullptr)
+    {
+        return *cachedShader;
+    }
+
+    std::shared_ptr<VulkanShaderModule> shader = loadShaderModule(kernelData);
+    shaderCache.insert(kernelData.getProgramName(), shaderKey, shader);
+    return shader;
+}
+
+std::string VulkanEngine::getShaderKey(const KernelRuntimeData& kernelData) const
+{
+    if (!specializationConstantFlag)
+    {
+        // Source with definitions contains values of all parameters which affect the shader
+        return kernelData.getSource();
+    }
+
+    // Local size is always passed as compiler definition, even if it is derived from parameters passed as specialization constants
+    std::string key = "#define LOCAL_SIZE_X " + std::to_string(kernelData.getLocalSize()[0]) + "\n#define LOCAL_SIZE_Y "
+        + std::to_string(kernelData.getLocalSize()[1]) + "\n#define LOCAL_SIZE_Z " + std::to_string(kernelData.getLocalSize()[2]) + "\n";
+
+    for (const auto& pair : getShaderParameters(kernelData))
+    {
+        const std::string value = pair.hasValueDouble() ? std::to_string(pair.getValueDouble()) : std::to_string(pair.getValue());
+        key += "#define " + pair.getName() + " " + value + "\n";
+    }
+
+    return key + kernelData.getUnmodifiedSource();
+}
+
+std::vector<ParameterPair> VulkanEngine::getShaderParameters(const KernelRuntimeData& kernelData) const
+{
+    if (!specializationConstantFlag)
+    {
+        return kernelData.getParameterPairs();
+    }
+
+    std::vector<ParameterPair> result;
+    size_t constantId = 0;
+
+    // Constant ids match the order used by VulkanSpecializationInfo
+    for (const auto& pair : kernelData.getParameterPairs())
+    {
+        if (pair.hasValueDouble())
+        {
+            result.push_back(pair);
+        }
+        else
+        {
+            result.emplace_back(pair.getName() + "_CONSTANT_ID", constantId);
+            ++constantId;
+        }
+    }
 
     return result;
 }
@@ -667,21 +1007,19 @@ VulkanBuffer* VulkanEngine::findBuffer(const ArgumentId id) const
 {
     if (persistentBufferFlag)
     {
-        for (const auto& buffer : persistentBuffers)
+        auto persistentPointer = persistentBuffers.find(id);
+
+        if (persistentPointer != persistentBuffers.end())
         {
-            if (buffer->getKernelArgumentId() == id)
-            {
-                return buffer.get();
-            }
+            return persistentPointer->second.get();
         }
     }
 
-    for (const auto& buffer : buffers)
+    auto bufferPointer = buffers.find(id);
+
+    if (bufferPointer != buffers.end())
     {
-        if (buffer->getKernelArgumentId() == id)
-        {
-            return buffer.get();
-        }
+        return bufferPointer->second.get();
     }
 
     return nullptr;
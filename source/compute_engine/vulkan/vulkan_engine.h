@@ -2,9 +2,13 @@
 
 #ifdef KTT_PLATFORM_VULKAN
 
+#include <deque>
+#include <future>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <vulkan/vulkan.h>
 #include <compute_engine/vulkan/vulkan_buffer.h>
@@ -17,6 +21,7 @@
 #include <compute_engine/vulkan/vulkan_device.h>
 #include <compute_engine/vulkan/vulkan_event.h>
 #include <compute_engine/vulkan/vulkan_instance.h>
+#include <compute_engine/vulkan/vulkan_pipeline_cache.h>
 #include <compute_engine/vulkan/vulkan_pipeline_cache_entry.h>
 #include <compute_engine/vulkan/vulkan_physical_device.h>
 #include <compute_engine/vulkan/vulkan_push_constant.h>
@@ -24,8 +29,13 @@
 #include <compute_engine/vulkan/vulkan_queue.h>
 #include <compute_engine/vulkan/vulkan_semaphore.h>
 #include <compute_engine/vulkan/vulkan_shader_module.h>
+#include <compute_engine/vulkan/vulkan_specialization_info.h>
 #include <compute_engine/vulkan/vulkan_utility.h>
+#include <compute_engine/compilation_failure_cache.h>
 #include <compute_engine/compute_engine.h>
+#include <compute_engine/kernel_cache.h>
+#include <compute_engine/program_binary_cache.h>
+#include <utility/thread_pool.h>
 
 namespace ktt
 {
@@ -35,6 +45,7 @@ class VulkanEngine : public ComputeEngine
 public:
     // Constructor
     explicit VulkanEngine(const DeviceIndex deviceIndex, const uint32_t queueCount);
+    ~VulkanEngine() override;
 
     // Kernel handling methods
     KernelResult runKernel(const KernelRuntimeData& kernelData, const std::vector<KernelArgument*>& argumentPointers,
@@ -42,14 +53,21 @@ public:
     EventId runKernelAsync(const KernelRuntimeData& kernelData, const std::vector<KernelArgument*>& argumentPointers, const QueueId queue) override;
     KernelResult getKernelResult(const EventId id, const std::vector<OutputDescriptor>& outputDescriptors) const override;
     uint64_t getKernelOverhead(const EventId id) const override;
+    void precompileKernel(const KernelRuntimeData& kernelData, const bool speculative) override;
 
     // Utility methods
     void setCompilerOptions(const std::string& options) override;
+    void setSpecializationConstantUsage(const bool flag) override;
     void setGlobalSizeType(const GlobalSizeType type) override;
     void setAutomaticGlobalSizeCorrection(const bool flag) override;
     void setKernelCacheUsage(const bool flag) override;
     void setKernelCacheCapacity(const size_t capacity) override;
     void clearKernelCache() override;
+    KernelCacheStatistics getKernelCacheStatistics() const override;
+    void setPersistentKernelCache(const std::string& directory, const size_t maximumSize) override;
+    std::map<std::string, uint64_t> getCompilationFailureCauses() const override;
+    void setCompilationThreadCount(const size_t count) override;
+    void setSpeculativeCacheCapacity(const size_t capacity) override;
 
     // Queue handling methods
     QueueId getDefaultQueue() const override;
@@ -70,8 +88,11 @@ public:
     EventId copyArgumentAsync(const ArgumentId destination, const ArgumentId source, const size_t dataSizeInBytes, const QueueId queue) override;
     uint64_t persistArgument(KernelArgument& kernelArgument, const bool flag) override;
     uint64_t getArgumentOperationDuration(const EventId id) const override;
+    size_t getArgumentBufferSize(const ArgumentId id) const override;
     void resizeArgument(const ArgumentId id, const size_t newSize, const bool preserveData) override;
     void setPersistentBufferUsage(const bool flag) override;
+    void setArgumentSnapshotUsage(const bool flag) override;
+    void setPinnedStagingUsage(const bool flag) override;
     void clearBuffer(const ArgumentId id) override;
     void clearBuffers() override;
     void clearBuffers(const ArgumentAccessType accessType) override;
@@ -98,25 +119,47 @@ private:
     GlobalSizeType globalSizeType;
     bool globalSizeCorrection;
     bool kernelCacheFlag;
-    size_t kernelCacheCapacity;
+    bool specializationConstantFlag;
+    size_t speculativeCacheCapacity;
     bool persistentBufferFlag;
     mutable EventId nextEventId;
     std::unique_ptr<VulkanInstance> instance;
     std::unique_ptr<VulkanDevice> device;
     std::unique_ptr<VulkanCommandPool> commandPool;
     std::unique_ptr<VulkanQueryPool> queryPool;
+    std::unique_ptr<VulkanPipelineCache> driverPipelineCache;
     std::vector<VulkanQueue> queues;
-    std::set<std::unique_ptr<VulkanBuffer>> buffers;
-    std::set<std::unique_ptr<VulkanBuffer>> persistentBuffers;
-    std::map<std::pair<std::string, std::string>, std::unique_ptr<VulkanPipelineCacheEntry>> pipelineCache;
+    std::unordered_map<ArgumentId, std::unique_ptr<VulkanBuffer>> buffers;
+    std::unordered_map<ArgumentId, std::unique_ptr<VulkanBuffer>> persistentBuffers;
+    KernelCache<std::unique_ptr<VulkanPipelineCacheEntry>> pipelineCache;
+    KernelCache<std::shared_ptr<VulkanShaderModule>> shaderCache;
+    std::map<std::pair<std::string, std::string>, std::future<std::vector<uint32_t>>> pendingShaders;
+    std::deque<std::pair<std::string, std::string>> speculativeShaders;
+    mutable ProgramBinaryCache binaryCache;
+    std::string binaryCacheIdentity;
+    mutable CompilationFailureCache failureCache;
     mutable std::map<EventId, std::unique_ptr<VulkanEvent>> kernelEvents;
     mutable std::map<EventId, std::unique_ptr<VulkanEvent>> bufferEvents;
     mutable std::map<EventId, std::unique_ptr<VulkanCommandBufferHolder>> eventCommands;
+    mutable std::vector<std::unique_ptr<VulkanCommandBufferHolder>> freeCommandBuffers;
     mutable std::map<EventId, std::unique_ptr<VulkanBuffer>> stagingBuffers;
 
+    // Declared last, so that background compilation is stopped before other resources are released
+    ThreadPool compilationPool;
+
     EventId enqueuePipeline(VulkanComputePipeline& pipeline, const std::vector<size_t>& globalSize, const std::vector<size_t>& localSize,
         const QueueId queue, const uint64_t kernelLaunchOverhead, const VulkanPushConstant& pushConstant);
     KernelResult createKernelResult(const EventId id) const;
+    std::unique_ptr<VulkanCommandBufferHolder> acquireCommandBuffer() const;
+    void releaseCommandBuffer(const EventId id) const;
+    void loadPipelineCache();
+    void storePipelineCache() const;
+    std::vector<uint32_t> compileShader(const KernelRuntimeData& kernelData) const;
+    std::future<std::vector<uint32_t>> compileShaderAsync(const KernelRuntimeData& kernelData, const bool lowPriority);
+    std::unique_ptr<VulkanShaderModule> loadShaderModule(const KernelRuntimeData& kernelData);
+    std::shared_ptr<VulkanShaderModule> getShaderModule(const KernelRuntimeData& kernelData);
+    std::string getShaderKey(const KernelRuntimeData& kernelData) const;
+    std::vector<ParameterPair> getShaderParameters(const KernelRuntimeData& kernelData) const;
     std::vector<VulkanBuffer*> getPipelineArguments(const std::vector<KernelArgument*>& argumentPointers);
     VulkanBuffer* findBuffer(const ArgumentId id) const;
     static std::vector<KernelArgument*> getScalarArguments(const std::vector<KernelArgument*>& arguments);
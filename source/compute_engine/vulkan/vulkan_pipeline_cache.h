@@ -0,0 +1,73 @@
+#pragma once
+
+#include <string>
+#include <vulkan/vulkan.h>
+#include <compute_engine/vulkan/vulkan_utility.h>
+
+namespace ktt
+{
+
+class VulkanPipelineCache
+{
+public:
+    explicit VulkanPipelineCache(VkDevice device) :
+        VulkanPipelineCache(device, std::string(""))
+    {}
+
+    // Driver validates the header of initial data and ignores data produced by incompatible device or driver
+    explicit VulkanPipelineCache(VkDevice device, const std::string& initialData) :
+        device(device)
+    {
+        const VkPipelineCacheCreateInfo pipelineCacheCreateInfo =
+        {
+            VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+            nullptr,
+            0,
+            initialData.size(),
+            initialData.empty() ? nullptr : initialData.data()
+        };
+
+        checkVulkanError(vkCreatePipelineCache(device, &pipelineCacheCreateInfo, nullptr, &pipelineCache), "vkCreatePipelineCache");
+    }
+
+    ~VulkanPipelineCache()
+    {
+        vkDestroyPipelineCache(device, pipelineCache, nullptr);
+    }
+
+    VkDevice getDevice() const
+    {
+        return device;
+    }
+
+    VkPipelineCache getPipelineCache() const
+    {
+        return pipelineCache;
+    }
+
+    std::string getData() const
+    {
+        size_t dataSize;
+        checkVulkanError(vkGetPipelineCacheData(device, pipelineCache, &dataSize, nullptr), "vkGetPipelineCacheData");
+
+        std::string data(dataSize, '\0');
+        checkVulkanError(vkGetPipelineCacheData(device, pipelineCache, &dataSize, &data[0]), "vkGetPipelineCacheData");
+        data.resize(dataSize);
+        return data;
+    }
+
+    void merge(const VulkanPipelineCache& source)
+    {
+        const VkPipelineCache sourceCache = source.getPipelineCache();
+        checkVulkanError(vkMergePipelineCaches(device, pipelineCache, 1, &sourceCache), "vkMergePipelineCaches");
+    }
+
+    VulkanPipelineCache(const VulkanPipelineCache&) = delete;
+    void operator=(const VulkanPipelineCache&) = delete;
+
+private:
+    VkDevice device;
+    VkPipelineCache pipelineCache;
+};
+
+} // namespace ktt
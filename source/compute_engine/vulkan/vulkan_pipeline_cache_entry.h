@@ -12,7 +12,7 @@ struct VulkanPipelineCacheEntry
 {
 public:
     VulkanPipelineCacheEntry(std::unique_ptr<VulkanComputePipeline> pipeline, std::unique_ptr<VulkanDescriptorSetLayout> layout,
-        std::unique_ptr<VulkanShaderModule> shader) :
+        std::shared_ptr<VulkanShaderModule> shader) :
         pipeline(std::move(pipeline)),
         layout(std::move(layout)),
         shader(std::move(shader))
@@ -20,7 +20,8 @@ public:
 
     std::unique_ptr<VulkanComputePipeline> pipeline;
     std::unique_ptr<VulkanDescriptorSetLayout> layout;
-    std::unique_ptr<VulkanShaderModule> shader;
+    // Shader module may be shared with other pipelines when parameters are passed as specialization constants
+    std::shared_ptr<VulkanShaderModule> shader;
 };
 
 } // namespace ktt
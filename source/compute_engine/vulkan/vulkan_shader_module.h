@@ -20,12 +20,16 @@ public:
 
     explicit VulkanShaderModule(VkDevice device, const std::string& name, const std::string& source, const std::vector<size_t>& localSize,
         const std::vector<ParameterPair>& parameterPairs) :
+        VulkanShaderModule(device, name, source, ShadercCompiler::getCompiler().compile(name, source, shaderc_compute_shader, localSize,
+            parameterPairs))
+    {}
+
+    explicit VulkanShaderModule(VkDevice device, const std::string& name, const std::string& source, const std::vector<uint32_t>& spirvSource) :
         device(device),
         name(name),
-        source(source)
+        source(source),
+        spirvSource(spirvSource)
     {
-        spirvSource = ShadercCompiler::getCompiler().compile(name, source, shaderc_compute_shader, localSize, parameterPairs);
-
         const VkShaderModuleCreateInfo shaderModuleCreateInfo =
         {
             VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
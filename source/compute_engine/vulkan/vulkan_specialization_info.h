@@ -1,9 +1,12 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
 #include <stdexcept>
+#include <string>
 #include <vector>
 #include <vulkan/vulkan.h>
+#include <api/parameter_pair.h>
 #include <kernel_argument/kernel_argument.h>
 
 namespace ktt
@@ -44,6 +47,44 @@ public:
         specializationInfo.pData = specializationData.data();
     }
 
+    // Integer parameters are assigned constant ids in the order in which they appear in configuration, values are passed as 32-bit integers
+    explicit VulkanSpecializationInfo(const std::vector<ParameterPair>& parameterPairs)
+    {
+        for (const auto& pair : parameterPairs)
+        {
+            if (pair.hasValueDouble())
+            {
+                continue;
+            }
+
+            if (pair.getValue() > std::numeric_limits<uint32_t>::max())
+            {
+                throw std::runtime_error(std::string("Value of parameter used as specialization constant does not fit into 32 bits: ")
+                    + pair.getName());
+            }
+
+            VkSpecializationMapEntry entry =
+            {
+                static_cast<uint32_t>(mapEntries.size()),
+                static_cast<uint32_t>(specializationData.size()),
+                sizeof(uint32_t)
+            };
+
+            const uint32_t value = static_cast<uint32_t>(pair.getValue());
+            const auto* valueBytes = reinterpret_cast<const uint8_t*>(&value);
+            specializationData.insert(specializationData.end(), valueBytes, valueBytes + sizeof(uint32_t));
+            mapEntries.push_back(entry);
+        }
+
+        specializationInfo.mapEntryCount = static_cast<uint32_t>(mapEntries.size());
+        specializationInfo.pMapEntries = mapEntries.data();
+        specializationInfo.dataSize = specializationData.size();
+        specializationInfo.pData = specializationData.data();
+    }
+
+    VulkanSpecializationInfo(const VulkanSpecializationInfo&) = delete;
+    void operator=(const VulkanSpecializationInfo&) = delete;
+
     VkSpecializationInfo specializationInfo;
     std::vector<VkSpecializationMapEntry> mapEntries;
     std::vector<uint8_t> specializationData;
@@ -10,7 +10,8 @@ KernelResult::KernelResult() :
     overhead(0),
     kernelTime(0),
     errorMessage(""),
-    valid(false)
+    valid(false),
+    censored(false)
 {}
 
 KernelResult::KernelResult(const std::string& kernelName, const KernelConfiguration& configuration) :
@@ -20,7 +21,8 @@ KernelResult::KernelResult(const std::string& kernelName, const KernelConfigurat
     overhead(0),
     kernelTime(0),
     errorMessage(""),
-    valid(true)
+    valid(true),
+    censored(false)
 {}
 
 KernelResult::KernelResult(const std::string& kernelName, uint64_t computationDuration) :
@@ -29,7 +31,8 @@ KernelResult::KernelResult(const std::string& kernelName, uint64_t computationDu
     overhead(0),
     kernelTime(0),
     errorMessage(""),
-    valid(true)
+    valid(true),
+    censored(false)
 {}
 
 KernelResult::KernelResult(const std::string& kernelName, const KernelConfiguration& configuration, const std::string& errorMessage) :
@@ -39,7 +42,8 @@ KernelResult::KernelResult(const std::string& kernelName, const KernelConfigurat
     overhead(0),
     kernelTime(0),
     errorMessage(errorMessage),
-    valid(false)
+    valid(false),
+    censored(false)
 {}
 
 void KernelResult::setKernelName(const std::string& kernelName)
@@ -92,6 +96,16 @@ void KernelResult::setCompositionKernelProfilingData(const KernelId id, const Ke
     this->compositionProfilingData[id] = profilingData;
 }
 
+void KernelResult::setMeasurementStatistics(const MeasurementStatistics& statistics)
+{
+    this->measurementStatistics = statistics;
+}
+
+void KernelResult::setCensored(const bool flag)
+{
+    this->censored = flag;
+}
+
 void KernelResult::setValid(const bool flag)
 {
     this->valid = flag;
@@ -170,11 +184,21 @@ const std::map<KernelId, KernelProfilingData>& KernelResult::getCompositionProfi
     return compositionProfilingData;
 }
 
+const MeasurementStatistics& KernelResult::getMeasurementStatistics() const
+{
+    return measurementStatistics;
+}
+
 bool KernelResult::isValid() const
 {
     return valid;
 }
 
+bool KernelResult::isCensored() const
+{
+    return censored;
+}
+
 void KernelResult::increaseOverhead(const uint64_t overhead)
 {
     this->overhead += overhead;
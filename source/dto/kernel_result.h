@@ -6,6 +6,7 @@
 #include <vector>
 #include <api/kernel_compilation_data.h>
 #include <api/kernel_profiling_data.h>
+#include <api/measurement_statistics.h>
 #include <kernel/kernel_configuration.h>
 
 namespace ktt
@@ -29,6 +30,8 @@ public:
     void setCompositionKernelCompilationData(const KernelId id, const KernelCompilationData& compilationData);
     void setProfilingData(const KernelProfilingData& profilingData);
     void setCompositionKernelProfilingData(const KernelId id, const KernelProfilingData& profilingData);
+    void setMeasurementStatistics(const MeasurementStatistics& statistics);
+    void setCensored(const bool flag);
     void setValid(const bool flag);
 
     const std::string& getKernelName() const;
@@ -43,7 +46,9 @@ public:
     const KernelProfilingData& getProfilingData() const;
     const KernelProfilingData& getCompositionKernelProfilingData(const KernelId id) const;
     const std::map<KernelId, KernelProfilingData>& getCompositionProfilingData() const;
+    const MeasurementStatistics& getMeasurementStatistics() const;
     bool isValid() const;
+    bool isCensored() const;
 
     void increaseOverhead(const uint64_t overhead);
     void increaseKernelTime(const uint64_t kernelTime);
@@ -59,7 +64,9 @@ private:
     std::map<KernelId, KernelCompilationData> compositionCompilationData;
     KernelProfilingData profilingData;
     std::map<KernelId, KernelProfilingData> compositionProfilingData;
+    MeasurementStatistics measurementStatistics;
     bool valid;
+    bool censored;
 };
 
 } // namespace ktt
@@ -22,7 +22,8 @@ KernelRuntimeData::KernelRuntimeData(const KernelId id, const std::string& name,
     localSizeDimensionVector(localSize),
     parameterPairs(parameterPairs),
     argumentIds(argumentIds),
-    localMemoryModifiers(localMemoryModifiers)
+    localMemoryModifiers(localMemoryModifiers),
+    compilerOptions("")
 {}
 
 void KernelRuntimeData::setGlobalSize(const DimensionVector& globalSize)
@@ -42,6 +43,11 @@ void KernelRuntimeData::setArgumentIndices(const std::vector<ArgumentId>& argume
     this->argumentIds = argumentIds;
 }
 
+void KernelRuntimeData::setCompilerOptions(const std::string& compilerOptions)
+{
+    this->compilerOptions = compilerOptions;
+}
+
 KernelId KernelRuntimeData::getId() const
 {
     return id;
@@ -62,6 +68,22 @@ const std::string& KernelRuntimeData::getUnmodifiedSource() const
     return unmodifiedSource;
 }
 
+const std::string& KernelRuntimeData::getCompilerOptions() const
+{
+    return compilerOptions;
+}
+
+std::string KernelRuntimeData::getProgramName() const
+{
+    // Source is shared between configurations when parameters are passed through compiler options, so the options identify the program
+    if (compilerOptions.empty())
+    {
+        return name;
+    }
+
+    return name + " " + compilerOptions;
+}
+
 const std::vector<size_t>& KernelRuntimeData::getGlobalSize() const
 {
     return globalSize;
@@ -24,11 +24,14 @@ public:
     void setGlobalSize(const DimensionVector& globalSize);
     void setLocalSize(const DimensionVector& localSize);
     void setArgumentIndices(const std::vector<ArgumentId>& argumentIds);
+    void setCompilerOptions(const std::string& compilerOptions);
 
     KernelId getId() const;
     const std::string& getName() const;
     const std::string& getSource() const;
     const std::string& getUnmodifiedSource() const;
+    const std::string& getCompilerOptions() const;
+    std::string getProgramName() const;
     const std::vector<size_t>& getGlobalSize() const;
     const std::vector<size_t>& getLocalSize() const;
     const DimensionVector& getGlobalSizeDimensionVector() const;
@@ -49,6 +52,7 @@ private:
     std::vector<ParameterPair> parameterPairs;
     std::vector<ArgumentId> argumentIds;
     std::vector<LocalMemoryModifier> localMemoryModifiers;
+    std::string compilerOptions;
 };
 
 } // namespace ktt
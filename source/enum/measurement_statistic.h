@@ -0,0 +1,32 @@
+/** @file measurement_statistic.h
+  * Definition of enum for statistic used to summarize repeated measurements of a single kernel configuration.
+  */
+#pragma once
+
+namespace ktt
+{
+
+/** @enum MeasurementStatistic
+  * Enum for statistic used to summarize repeated measurements of a single kernel configuration. Selected statistic is used as computation
+  * duration of the configuration, eg. when searching for the best configuration.
+  */
+enum class MeasurementStatistic
+{
+    /** The shortest of measured durations.
+      */
+    Minimum,
+
+    /** Median of measured durations.
+      */
+    Median,
+
+    /** Arithmetic mean of measured durations.
+      */
+    Mean,
+
+    /** The longest of measured durations.
+      */
+    Maximum
+};
+
+} // namespace ktt
@@ -0,0 +1,32 @@
+/** @file objective_metric.h
+  * Definition of enum for built-in metrics which can be used as tuning objectives.
+  */
+#pragma once
+
+namespace ktt
+{
+
+/** @enum ObjectiveMetric
+  * Enum for built-in metrics which can be used as tuning objectives. All metrics are minimized. For kernel compositions, metrics based on
+  * compilation data use maximum value among all kernels in the composition.
+  */
+enum class ObjectiveMetric
+{
+    /** Computation duration in nanoseconds.
+      */
+    Duration,
+
+    /** Amount of local memory used by kernel in bytes.
+      */
+    LocalMemory,
+
+    /** Amount of private memory used by kernel in bytes.
+      */
+    PrivateMemory,
+
+    /** Number of registers used by kernel.
+      */
+    Registers
+};
+
+} // namespace ktt
@@ -19,9 +19,19 @@ enum class ValidationMethod
       */
     SideBySideComparison,
 
-    /** Calculates difference for each pair of elements, then compares the difference divided by reference value to specified threshold.
+    /** Calculates difference for each pair of elements, then compares the difference divided by absolute reference value to specified
+      * threshold. Differences which do not exceed relative validation floor are ignored, see Tuner::setRelativeValidationFloor().
       */
-    SideBySideRelativeComparison
+    SideBySideRelativeComparison,
+
+    /** Calculates distance in units in the last place for each pair of elements, then compares the distance to specified integral threshold.
+      * Positive and negative zero have zero distance, pairs containing NaN always exceed the threshold.
+      */
+    SideBySideUlpComparison,
+
+    /** Calculates root mean square of differences between each pair of elements, then compares it to specified threshold.
+      */
+    RootMeanSquareError
 };
 
 } // namespace ktt
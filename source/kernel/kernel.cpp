@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <cctype>
 #include <stdexcept>
 #include <kernel/kernel.h>
 #include <utility/ktt_utility.h>
@@ -15,8 +16,11 @@ Kernel::Kernel(const KernelId id, const std::string& source, const std::string&
     localSize(localSize),
     globalThreadModifiers{nullptr, nullptr, nullptr},
     localThreadModifiers{nullptr, nullptr, nullptr},
-    tuningManipulatorFlag(false)
-{}
+    tuningManipulatorFlag(false),
+    sourceIncludesFiles(false)
+{
+    parseSourceIdentifiers();
+}
 
 void Kernel::addParameter(const KernelParameter& parameter)
 {
@@ -110,6 +114,11 @@ void Kernel::setTuningManipulatorFlag(const bool flag)
     this->tuningManipulatorFlag = flag;
 }
 
+void Kernel::addHostOnlyParameter(const std::string& parameterName)
+{
+    hostOnlyParameters.insert(parameterName);
+}
+
 uint64_t Kernel::getConfigurationsCount() const
 {
     uint64_t result = 1;
@@ -417,6 +426,17 @@ bool Kernel::hasTuningManipulator() const
     return tuningManipulatorFlag;
 }
 
+bool Kernel::isParameterUsedInSource(const std::string& parameterName) const
+{
+    if (hostOnlyParameters.find(parameterName) != hostOnlyParameters.cend())
+    {
+        return false;
+    }
+
+    // Included files are not available, so parameters may be used inside them
+    return sourceIncludesFiles || sourceIdentifiers.find(parameterName) != sourceIdentifiers.cend();
+}
+
 void Kernel::validateModifierParameters(const std::vector<std::string>& parameterNames) const
 {
     for (const auto& parameterName : parameterNames)
@@ -444,4 +464,51 @@ void Kernel::validateModifierParameters(const std::vector<std::string>& paramete
     }
 }
 
+void Kernel::parseSourceIdentifiers()
+{
+    size_t position = 0;
+    char previousSymbol = '\0';
+
+    while (position < source.size())
+    {
+        const char symbol = source[position];
+
+        if (std::isalpha(static_cast<unsigned char>(symbol)) || symbol == '_')
+        {
+            const size_t start = position;
+            while (position < source.size() && (std::isalnum(static_cast<unsigned char>(source[position])) || source[position] == '_'))
+            {
+                position++;
+            }
+
+            const std::string identifier = source.substr(start, position - start);
+            if (previousSymbol == '#' && identifier == "include")
+            {
+                sourceIncludesFiles = true;
+            }
+
+            sourceIdentifiers.insert(identifier);
+            previousSymbol = 'a';
+            continue;
+        }
+
+        if (std::isdigit(static_cast<unsigned char>(symbol)))
+        {
+            // Numeric literals such as 1e5f or 0x1F do not contain identifiers
+            while (position < source.size() && (std::isalnum(static_cast<unsigned char>(source[position])) || source[position] == '.'))
+            {
+                position++;
+            }
+            previousSymbol = '0';
+            continue;
+        }
+
+        if (!std::isspace(static_cast<unsigned char>(symbol)))
+        {
+            previousSymbol = symbol;
+        }
+        position++;
+    }
+}
+
 } // namespace ktt
@@ -3,6 +3,7 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 #include <api/dimension_vector.h>
@@ -35,6 +36,7 @@ public:
         const std::function<size_t(const size_t, const std::vector<size_t>&)>& modifierFunction);
     void setArguments(const std::vector<ArgumentId>& argumentIds);
     void setTuningManipulatorFlag(const bool flag);
+    void addHostOnlyParameter(const std::string& parameterName);
 
     // Configurations
     uint64_t getConfigurationsCount() const;
@@ -60,6 +62,7 @@ public:
     std::vector<LocalMemoryModifier> getLocalMemoryModifiers(const std::vector<ParameterPair>& parameterPairs) const;
     bool hasParameter(const std::string& parameterName) const;
     bool hasTuningManipulator() const;
+    bool isParameterUsedInSource(const std::string& parameterName) const;
 
 private:
     // Attributes
@@ -79,8 +82,12 @@ private:
     std::map<ArgumentId, std::vector<std::string>> localMemoryModifierNames;
     std::map<ArgumentId, std::function<size_t(const size_t, const std::vector<size_t>&)>> localMemoryModifiers;
     bool tuningManipulatorFlag;
+    std::set<std::string> sourceIdentifiers;
+    bool sourceIncludesFiles;
+    std::set<std::string> hostOnlyParameters;
 
     void validateModifierParameters(const std::vector<std::string>& parameterNames) const;
+    void parseSourceIdentifiers();
 };
 
 } // namespace ktt
@@ -2,6 +2,7 @@
 #include <sstream>
 #include <kernel/kernel_manager.h>
 #include <utility/ktt_utility.h>
+#include <utility/logger.h>
 
 namespace ktt
 {
@@ -52,23 +53,43 @@ std::string KernelManager::getKernelSourceWithDefines(const KernelId id, const K
 
 std::string KernelManager::getKernelSourceWithDefines(const KernelId id, const std::vector<ParameterPair>& configuration) const
 {
-    std::string source = getKernel(id).getSource();
+    const Kernel& kernel = getKernel(id);
+    std::stringstream stream;
+
+    // Definitions are emitted in reverse order and the source is appended only once
+    for (auto parameterPair = configuration.crbegin(); parameterPair != configuration.crend(); ++parameterPair)
+    {
+        // Configurations which differ only in unused parameters produce identical source, so they share compiled program
+        if (kernel.isParameterUsedInSource(parameterPair->getName()))
+        {
+            stream << "#define " << parameterPair->getName() << " " << getParameterValueString(*parameterPair) << "\n";
+        }
+    }
+
+    stream << kernel.getSource();
+    return stream.str();
+}
+
+std::string KernelManager::getParameterDefinitions(const KernelId id, const KernelConfiguration& configuration) const
+{
+    const Kernel& kernel = getKernel(id);
+    std::string definitions;
 
-    for (const auto& parameterPair : configuration)
+    for (const auto& parameterPair : configuration.getParameterPairs())
     {
-        std::stringstream stream;
-        if (!parameterPair.hasValueDouble())
+        if (!kernel.isParameterUsedInSource(parameterPair.getName()))
         {
-            stream << parameterPair.getValue();
+            continue;
         }
-        else
+
+        if (!definitions.empty())
         {
-            stream << parameterPair.getValueDouble();
+            definitions += " ";
         }
-        source = std::string("#define ") + parameterPair.getName() + std::string(" ") + stream.str() + std::string("\n") + source;
+        definitions += std::string("-D") + parameterPair.getName() + "=" + getParameterValueString(parameterPair);
     }
 
-    return source;
+    return definitions;
 }
 
 KernelConfiguration KernelManager::getKernelConfiguration(const KernelId id, const std::vector<ParameterPair>& parameterPairs) const
@@ -112,6 +133,12 @@ void KernelManager::addParameter(const KernelId id, const std::string& name, con
     if (isKernel(id))
     {
         getKernel(id).addParameter(KernelParameter(name, values));
+
+        if (!getKernel(id).isParameterUsedInSource(name))
+        {
+            Logger::logDebug(std::string("Parameter ") + name + " does not appear in source of kernel " + getKernel(id).getName()
+                + ", configurations which differ only in its value will share compiled program");
+        }
     }
     else if (isComposition(id))
     {
@@ -133,6 +160,12 @@ void KernelManager::addParameter(const KernelId id, const std::string& name, con
     if (isKernel(id))
     {
         getKernel(id).addParameter(KernelParameter(name, values));
+
+        if (!getKernel(id).isParameterUsedInSource(name))
+        {
+            Logger::logDebug(std::string("Parameter ") + name + " does not appear in source of kernel " + getKernel(id).getName()
+                + ", configurations which differ only in its value will share compiled program");
+        }
     }
     else if (isComposition(id))
     {
@@ -275,6 +308,44 @@ void KernelManager::setTuningManipulatorFlag(const KernelId id, const bool flag)
     getKernel(id).setTuningManipulatorFlag(flag);
 }
 
+void KernelManager::setHostOnlyParameters(const KernelId id, const std::vector<std::string>& parameterNames)
+{
+    if (isKernel(id))
+    {
+        Kernel& kernel = getKernel(id);
+
+        for (const auto& parameterName : parameterNames)
+        {
+            if (!kernel.hasParameter(parameterName))
+            {
+                throw std::runtime_error(std::string("Parameter with name ") + parameterName + " does not exist");
+            }
+            kernel.addHostOnlyParameter(parameterName);
+        }
+    }
+    else if (isComposition(id))
+    {
+        const KernelComposition& composition = getKernelComposition(id);
+
+        for (const auto& parameterName : parameterNames)
+        {
+            if (!composition.hasParameter(parameterName))
+            {
+                throw std::runtime_error(std::string("Parameter with name ") + parameterName + " does not exist");
+            }
+
+            for (const auto* kernel : composition.getKernels())
+            {
+                getKernel(kernel->getId()).addHostOnlyParameter(parameterName);
+            }
+        }
+    }
+    else
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+}
+
 void KernelManager::setCompositionKernelProfiling(const KernelId compositionId, const KernelId kernelId, const bool flag)
 {
     if (!isComposition(compositionId))
@@ -352,6 +423,22 @@ bool KernelManager::isComposition(const KernelId id) const
     return false;
 }
 
+std::string KernelManager::getParameterValueString(const ParameterPair& parameterPair)
+{
+    std::stringstream stream;
+
+    if (!parameterPair.hasValueDouble())
+    {
+        stream << parameterPair.getValue();
+    }
+    else
+    {
+        stream << parameterPair.getValueDouble();
+    }
+
+    return stream.str();
+}
+
 std::string KernelManager::loadFileToString(const std::string& filePath)
 {
     std::ifstream file(filePath);
@@ -23,6 +23,7 @@ public:
     KernelId addKernelComposition(const std::string& compositionName, const std::vector<KernelId>& kernelIds);
     std::string getKernelSourceWithDefines(const KernelId id, const KernelConfiguration& configuration) const;
     std::string getKernelSourceWithDefines(const KernelId id, const std::vector<ParameterPair>& configuration) const;
+    std::string getParameterDefinitions(const KernelId id, const KernelConfiguration& configuration) const;
     KernelConfiguration getKernelConfiguration(const KernelId id, const std::vector<ParameterPair>& parameterPairs) const;
     KernelConfiguration getKernelCompositionConfiguration(const KernelId compositionId, const std::vector<ParameterPair>& parameterPairs) const;
 
@@ -44,6 +45,7 @@ public:
     void setArguments(const KernelId id, const std::vector<ArgumentId>& argumentIds);
     void setCompositionKernelArguments(const KernelId compositionId, const KernelId kernelId, const std::vector<ArgumentId>& argumentIds);
     void setTuningManipulatorFlag(const KernelId id, const bool flag);
+    void setHostOnlyParameters(const KernelId id, const std::vector<std::string>& parameterNames);
     void setCompositionKernelProfiling(const KernelId compositionId, const KernelId kernelId, const bool flag);
 
     // Getters
@@ -63,6 +65,7 @@ private:
 
     // Helper methods
     static std::string loadFileToString(const std::string& filePath);
+    static std::string getParameterValueString(const ParameterPair& parameterPair);
 };
 
 } // namespace ktt
@@ -15,7 +15,8 @@ KernelArgument::KernelArgument(const ArgumentId id, const size_t numberOfElement
     argumentUploadType(uploadType),
     referencedData(nullptr),
     dataOwned(true),
-    persistentFlag(false)
+    persistentFlag(false),
+    dataVersion(0)
 {
     if (numberOfElements == 0)
     {
@@ -36,7 +37,8 @@ KernelArgument::KernelArgument(const ArgumentId id, void* data, const size_t num
     argumentUploadType(uploadType),
     referencedData(nullptr),
     dataOwned(dataOwned),
-    persistentFlag(false)
+    persistentFlag(false),
+    dataVersion(0)
 {
     if (numberOfElements == 0)
     {
@@ -65,7 +67,8 @@ KernelArgument::KernelArgument(const ArgumentId id, const void* data, const size
     argumentUploadType(uploadType),
     referencedData(nullptr),
     dataOwned(true),
-    persistentFlag(false)
+    persistentFlag(false),
+    dataVersion(0)
 {
     if (numberOfElements == 0 && data != nullptr)
     {
@@ -86,6 +89,8 @@ void KernelArgument::updateData(void* data, const size_t numberOfElements)
     }
 
     this->numberOfElements = numberOfElements;
+    ++dataVersion;
+
     if (dataOwned)
     {
         initializeData(data);
@@ -104,6 +109,8 @@ void KernelArgument::updateData(const void* data, const size_t numberOfElements)
     }
 
     this->numberOfElements = numberOfElements;
+    ++dataVersion;
+
     if (data != nullptr)
     {
         initializeData(data);
@@ -180,6 +187,11 @@ bool KernelArgument::isPersistent() const
     return persistentFlag;
 }
 
+uint64_t KernelArgument::getDataVersion() const
+{
+    return dataVersion;
+}
+
 bool KernelArgument::operator==(const KernelArgument& other) const
 {
     return id == other.id;
@@ -43,6 +43,8 @@ public:
     void* getData();
     bool hasOwnedData() const;
     bool isPersistent() const;
+    // Incremented with each update of argument data, data can be updated in place without changing its address or size
+    uint64_t getDataVersion() const;
 
     template <typename T>
     const T* getDataWithType() const
@@ -78,6 +80,7 @@ private:
     void* referencedData;
     bool dataOwned;
     bool persistentFlag;
+    uint64_t dataVersion;
 
     // Helper methods
     void initializeData(const void* data);
@@ -87,6 +87,18 @@ void Tuner::addParameterPack(const KernelId id, const std::string& packName, con
     }
 }
 
+void Tuner::setHostOnlyParameters(const KernelId id, const std::vector<std::string>& parameterNames)
+{
+    try
+    {
+        tunerCore->setHostOnlyParameters(id, parameterNames);
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+    }
+}
+
 void Tuner::setThreadModifier(const KernelId id, const ModifierType modifierType, const ModifierDimension modifierDimension,
     const std::vector<std::string>& parameterNames, const std::function<size_t(const size_t, const std::vector<size_t>&)>& modifierFunction)
 {
@@ -267,6 +279,23 @@ void Tuner::persistArgument(const ArgumentId id, const bool flag)
     }
 }
 
+void Tuner::setArgumentSnapshotUsage(const bool flag)
+{
+    try
+    {
+        tunerCore->setArgumentSnapshotUsage(flag);
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+    }
+}
+
+void Tuner::setPinnedStagingUsage(const bool flag)
+{
+    tunerCore->setPinnedStagingUsage(flag);
+}
+
 void Tuner::downloadPersistentArgument(const OutputDescriptor& output) const
 {
     try
@@ -410,6 +439,135 @@ void Tuner::setSearchMethod(const SearchMethod method, const std::vector<double>
     }
 }
 
+void Tuner::setSearcher(const KernelId id, std::unique_ptr<Searcher> searcher)
+{
+    try
+    {
+        tunerCore->setSearcher(id, std::move(searcher));
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+    }
+}
+
+void Tuner::setWarmStart(const KernelId id, const std::vector<std::string>& filePaths, const size_t seedCount)
+{
+    try
+    {
+        tunerCore->setWarmStart(id, filePaths, seedCount);
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+    }
+}
+
+void Tuner::setMeasurementRepetitions(const size_t warmUpRuns, const size_t timedRuns)
+{
+    try
+    {
+        tunerCore->setMeasurementRepetitions(warmUpRuns, timedRuns);
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+    }
+}
+
+void Tuner::setMeasurementStatistic(const MeasurementStatistic statistic)
+{
+    tunerCore->setMeasurementStatistic(statistic);
+}
+
+void Tuner::setAdaptiveMeasurement(const double relativeConfidenceInterval, const size_t maximumTimedRuns)
+{
+    try
+    {
+        tunerCore->setAdaptiveMeasurement(relativeConfidenceInterval, maximumTimedRuns);
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+    }
+}
+
+void Tuner::setMeasurementRacing(const double factor)
+{
+    try
+    {
+        tunerCore->setMeasurementRacing(factor);
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+    }
+}
+
+void Tuner::setFinalistRemeasurement(const size_t finalistCount, const size_t rounds)
+{
+    tunerCore->setFinalistRemeasurement(finalistCount, rounds);
+}
+
+void Tuner::setInterferenceDetection(const size_t sentinelInterval, const double driftThreshold, const double loadThreshold)
+{
+    try
+    {
+        tunerCore->setInterferenceDetection(sentinelInterval, driftThreshold, loadThreshold);
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+    }
+}
+
+void Tuner::setCompilationLookahead(const size_t count)
+{
+    tunerCore->setCompilationLookahead(count);
+}
+
+void Tuner::setSpeculativeCompilation(const size_t candidateCount)
+{
+    tunerCore->setSpeculativeCompilation(candidateCount);
+}
+
+void Tuner::addObjective(const KernelId id, const ObjectiveMetric metric, const double weight, const double limit)
+{
+    try
+    {
+        tunerCore->addObjective(id, metric, weight, limit);
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+    }
+}
+
+void Tuner::addObjective(const KernelId id, const std::string& name, const std::function<double(const ComputationResult&)>& metric,
+    const double weight, const double limit)
+{
+    try
+    {
+        tunerCore->addObjective(id, name, metric, weight, limit);
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+    }
+}
+
+void Tuner::clearObjectives(const KernelId id)
+{
+    try
+    {
+        tunerCore->clearObjectives(id);
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+    }
+}
+
 void Tuner::setPrintingTimeUnit(const TimeUnit unit)
 {
     tunerCore->setPrintingTimeUnit(unit);
@@ -457,6 +615,19 @@ ComputationResult Tuner::getBestComputationResult(const KernelId id) const
     }
 }
 
+std::vector<ComputationResult> Tuner::getParetoFront(const KernelId id) const
+{
+    try
+    {
+        return tunerCore->getParetoFront(id);
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+        return std::vector<ComputationResult>{};
+    }
+}
+
 std::string Tuner::getKernelSource(const KernelId id, const std::vector<ParameterPair>& configuration) const
 {
     try
@@ -512,6 +683,18 @@ void Tuner::setValidationMethod(const ValidationMethod method, const double tole
     }
 }
 
+void Tuner::setRelativeValidationFloor(const double floor)
+{
+    try
+    {
+        tunerCore->setRelativeValidationFloor(floor);
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+    }
+}
+
 void Tuner::setValidationRange(const ArgumentId id, const size_t range)
 {
     try
@@ -536,16 +719,67 @@ void Tuner::setArgumentComparator(const ArgumentId id, const std::function<bool(
     }
 }
 
+void Tuner::setAsynchronousValidation(const bool flag)
+{
+    tunerCore->setAsynchronousValidation(flag);
+}
+
 void Tuner::setCompilerOptions(const std::string& options)
 {
     tunerCore->setCompilerOptions(options);
 }
 
+void Tuner::setParameterDefinitionsAsCompilerOptions(const bool flag)
+{
+    tunerCore->setParameterDefinitionsAsCompilerOptions(flag);
+}
+
+void Tuner::setSpecializationConstantUsage(const bool flag)
+{
+    try
+    {
+        tunerCore->setSpecializationConstantUsage(flag);
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+    }
+}
+
 void Tuner::setKernelCacheCapacity(const size_t capacity)
 {
     tunerCore->setKernelCacheCapacity(capacity);
 }
 
+KernelCacheStatistics Tuner::getKernelCacheStatistics() const
+{
+    return tunerCore->getKernelCacheStatistics();
+}
+
+void Tuner::setCompilationThreadCount(const size_t count)
+{
+    try
+    {
+        tunerCore->setCompilationThreadCount(count);
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+    }
+}
+
+void Tuner::setPersistentKernelCache(const std::string& directory, const size_t maximumSize)
+{
+    try
+    {
+        tunerCore->setPersistentKernelCache(directory, maximumSize);
+    }
+    catch (const std::runtime_error& error)
+    {
+        TunerCore::log(LoggingLevel::Error, error.what());
+    }
+}
+
 void Tuner::printComputeAPIInfo(std::ostream& outputTarget) const
 {
     try
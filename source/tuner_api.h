@@ -5,6 +5,7 @@
 
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -24,9 +25,11 @@
 #include <enum/compute_api.h>
 #include <enum/global_size_type.h>
 #include <enum/logging_level.h>
+#include <enum/measurement_statistic.h>
 #include <enum/modifier_action.h>
 #include <enum/modifier_dimension.h>
 #include <enum/modifier_type.h>
+#include <enum/objective_metric.h>
 #include <enum/print_format.h>
 #include <enum/time_unit.h>
 #include <enum/search_method.h>
@@ -37,6 +40,7 @@
 #include <api/computation_result.h>
 #include <api/device_info.h>
 #include <api/dimension_vector.h>
+#include <api/kernel_cache_statistics.h>
 #include <api/output_descriptor.h>
 #include <api/platform_info.h>
 
@@ -52,6 +56,9 @@
 // Tuning manipulator interface
 #include <api/tuning_manipulator.h>
 
+// Searcher interface
+#include <api/searcher/searcher.h>
+
 // Support for 16-bit floating point data type
 #include <half.hpp>
 
@@ -166,6 +173,15 @@ public:
       */
     void addParameterPack(const KernelId id, const std::string& packName, const std::vector<std::string>& parameterNames);
 
+    /** @fn void setHostOnlyParameters(const KernelId id, const std::vector<std::string>& parameterNames)
+      * Declares kernel parameters which are used only on host side, eg. inside tuning manipulator or thread modifiers. These parameters are
+      * not added to kernel source code as preprocessor definitions, so configurations which differ only in their values share the same compiled
+      * program. Parameters which do not appear in kernel source are detected automatically, unless the source contains include directives.
+      * @param id Id of kernel or composition for which the parameters will be declared. Declaration for composition applies to all of its kernels.
+      * @param parameterNames Names of existing parameters which are not used by kernel source code.
+      */
+    void setHostOnlyParameters(const KernelId id, const std::vector<std::string>& parameterNames);
+
     /** @fn void setThreadModifier(const KernelId id, const ModifierType modifierType, const ModifierDimension modifierDimension,
       * const std::vector<std::string>& parameterNames, const std::function<size_t(const size_t, const std::vector<size_t>&)>& modifierFunction)
       * Sets a thread modifier function for specified kernel. This function receives thread size in specified kernel dimension and values of
@@ -385,6 +401,31 @@ public:
       */
     void persistArgument(const ArgumentId id, const bool flag);
 
+    /** @fn void setArgumentSnapshotUsage(const bool flag)
+      * Toggles keeping of device-side snapshots of write-only and read-write vector arguments. Buffers of these arguments are destroyed after
+      * each kernel configuration is run. With snapshots enabled, the first upload of an argument also creates a pristine copy of it in device
+      * memory and subsequent uploads restore the buffer from that copy with device-to-device transfer instead of transferring data from host.
+      * This reduces transfer overhead during tuning of kernels with large output buffers at the cost of additional device memory. Snapshot is
+      * recreated after host data of the argument is updated. Arguments which reference user data without copying it and arguments with host
+      * or zero-copy memory location are not snapshotted. Only supported by OpenCL and CUDA back-ends. By default, snapshots are disabled.
+      * @param flag If true, snapshots of write-only and read-write arguments are kept in device memory. If false, existing snapshots are
+      * immediately destroyed.
+      */
+    void setArgumentSnapshotUsage(const bool flag);
+
+    /** @fn void setPinnedStagingUsage(const bool flag)
+      * Toggles staging of argument transfers through page-locked host memory. Data of vector arguments with device memory location is copied
+      * into a staging buffer allocated by compute API before upload and downloaded into such buffer before it is copied to its destination.
+      * Transfers from page-locked memory are performed directly by device DMA engine, which is faster than transfers from pageable memory on
+      * most dedicated devices. Staging buffers are reused for subsequent transfers. Reported transfer durations include the host copy, so
+      * both variants can be compared, e.g., devices sharing memory with host usually perform better without staging. Asynchronous downloads
+      * are never staged. Vulkan back-end always transfers data through staging buffers, so this setting has no effect on it. By default,
+      * staging is disabled.
+      * @param flag If true, argument transfers are staged through page-locked host memory. Otherwise, they are performed directly from
+      * argument data.
+      */
+    void setPinnedStagingUsage(const bool flag);
+
     /** @fn void downloadPersistentArgument(const OutputDescriptor& output) const
       * Downloads specified persistent argument from compute API buffer into specified memory location.
       * @param output User-provided memory location for persistent kernel argument which should be retrieved. See OutputDescriptor for more information.
@@ -510,6 +551,156 @@ public:
       */
     void setSearchMethod(const SearchMethod method, const std::vector<double>& arguments);
 
+    /** @fn void setSearcher(const KernelId id, std::unique_ptr<Searcher> searcher)
+      * Sets custom searcher for specified kernel or kernel composition. Custom searcher takes precedence over search method specified by
+      * setSearchMethod() method. The same searcher object is reused for all tuning runs and parameter packs of specified kernel. See Searcher for
+      * more information.
+      * @param id Id of kernel or kernel composition for which the searcher will be set.
+      * @param searcher Searcher which will be used during tuning of specified kernel. If nullptr, previously set custom searcher is removed and
+      * search method specified by setSearchMethod() method is used instead.
+      */
+    void setSearcher(const KernelId id, std::unique_ptr<Searcher> searcher);
+
+    /** @fn void setWarmStart(const KernelId id, const std::vector<std::string>& filePaths, const size_t seedCount)
+      * Enables warm start of tuning for specified kernel or kernel composition from results of previous tuning runs, eg. on different device or
+      * with different input size. Configurations with the best durations in previous results are measured first. Afterwards, configurations are
+      * explored in order of their distance from the best configuration measured so far. Warm start takes precedence over search method specified
+      * by setSearchMethod() method, custom searcher set by setSearcher() method takes precedence over warm start. Should be called after all
+      * parameters of specified kernel were added.
+      * @param id Id of kernel or kernel composition for which the warm start will be enabled.
+      * @param filePaths Paths to files with previous results printed in CSV format. See printResult() for more information. Tuning parameters
+      * which are not present in previous results are ignored when ranking configurations.
+      * @param seedCount Number of best configurations taken from each file which will be measured first. If zero, warm start is disabled.
+      */
+    void setWarmStart(const KernelId id, const std::vector<std::string>& filePaths, const size_t seedCount);
+
+    /** @fn void setMeasurementRepetitions(const size_t warmUpRuns, const size_t timedRuns)
+      * Sets number of runs performed for each configuration during kernel tuning. Warm-up runs are performed first and are not timed, eg. in
+      * order to exclude kernel compilation and device clock ramp-up from the measurement. Timed runs follow and their durations are summarized
+      * by statistic specified with setMeasurementStatistic() method. Buffers with writable arguments are restored before each run, output is
+      * retrieved and validated only in the last run. Repetitions are not performed when kernel profiling is enabled. By default, single timed run
+      * without warm-up is performed. Disables adaptive measurement, see setAdaptiveMeasurement() for more information.
+      * @param warmUpRuns Number of warm-up runs performed for each configuration.
+      * @param timedRuns Number of timed runs performed for each configuration. Must be greater than zero.
+      */
+    void setMeasurementRepetitions(const size_t warmUpRuns, const size_t timedRuns);
+
+    /** @fn void setMeasurementStatistic(const MeasurementStatistic statistic)
+      * Sets statistic which is used as computation duration of configuration measured by multiple timed runs. The same duration is used by
+      * searchers and during selection of the best configuration. Statistics of all timed runs can be retrieved with
+      * ComputationResult::getMeasurementStatistics() method. Default statistic is median.
+      * @param statistic Statistic used as computation duration. See ::MeasurementStatistic for more information.
+      */
+    void setMeasurementStatistic(const MeasurementStatistic statistic);
+
+    /** @fn void setAdaptiveMeasurement(const double relativeConfidenceInterval, const size_t maximumTimedRuns)
+      * Enables adaptive number of timed runs for each configuration during kernel tuning. After the number of timed runs specified with
+      * setMeasurementRepetitions() method (at least two) is reached, configuration is re-run until half-width of 95% confidence interval of mean
+      * duration is within specified fraction of the mean or maximum number of timed runs is reached. Measurement also stops once lower bound
+      * of the confidence interval exceeds duration of the best configuration found so far. In adaptive mode, output is retrieved after each run.
+      * @param relativeConfidenceInterval Maximum half-width of confidence interval relative to mean duration, eg. 0.02 for 2%.
+      * @param maximumTimedRuns Maximum number of timed runs for each configuration. If it is not greater than number of timed runs specified
+      * with setMeasurementRepetitions() method, adaptive measurement is disabled. Changing number of timed runs afterwards also disables adaptive
+      * measurement, so this method should be called after setMeasurementRepetitions() method.
+      */
+    void setAdaptiveMeasurement(const double relativeConfidenceInterval, const size_t maximumTimedRuns);
+
+    /** @fn void setMeasurementRacing(const double factor)
+      * Enables early termination of configurations which are much slower than the best configuration found so far during kernel tuning. For
+      * kernels and compositions with tuning manipulator, kernel time accumulated by the manipulator is checked after each synchronous kernel run
+      * and synchronization. Once it exceeds duration of the best configuration multiplied by specified factor, the manipulator is terminated.
+      * Such configuration is not treated as failed, its result is marked as censored and its duration is a lower bound of the real duration.
+      * See ComputationResult::isCensored() for more information. For all kernels, remaining timed runs of configuration are skipped once
+      * the limit is exceeded. Timed runs which completed before termination are kept in measurement statistics of censored result. Racing is not
+      * performed when kernel profiling is enabled. Manipulator is terminated with an exception which is not derived from std::exception, tuning
+      * manipulators which catch all exceptions have to rethrow it.
+      * @param factor Multiple of the best duration after which configuration is terminated. Must be at least one, zero disables racing.
+      */
+    void setMeasurementRacing(const double factor);
+
+    /** @fn void setFinalistRemeasurement(const size_t finalistCount, const size_t rounds)
+      * Enables final phase of kernel tuning performed with tuneKernel() method. After the search ends, specified number of configurations
+      * with the best objective value is re-measured in multiple rounds. Each round runs every finalist once, order of finalists is rotated
+      * between rounds in order to cancel drift of device performance. Durations of finalists are replaced by statistic of all rounds
+      * specified with setMeasurementStatistic() method, both in the results returned by tuneKernel() and in printed results, and the best
+      * configuration is chosen among them. Finalist re-measurement is not performed when kernel profiling is enabled. By default,
+      * re-measurement is disabled.
+      * @param finalistCount Number of best configurations which are re-measured. Zero disables re-measurement.
+      * @param rounds Number of rounds in which finalists are re-measured. Zero disables re-measurement.
+      */
+    void setFinalistRemeasurement(const size_t finalistCount, const size_t rounds);
+
+    /** @fn void setInterferenceDetection(const size_t sentinelInterval, const double driftThreshold, const double loadThreshold)
+      * Enables detection of measurements affected by other processes during kernel tuning performed with tuneKernel() method. The first
+      * successfully measured configuration becomes sentinel and is re-run after every specified number of measured configurations. If its
+      * duration drifts from the initial value by more than specified fraction, configurations measured between this check and both
+      * neighbouring checks are flagged. Configurations measured while the share of host CPU time used by other processes exceeded specified
+      * threshold are flagged as well. Host load is evaluated over a window of at least 10 clock ticks, which spans multiple consecutive
+      * measurements of short kernels. Flagged configurations are re-measured after the search ends and the number of affected measurements
+      * is reported in the log.
+      * @param sentinelInterval Number of measured configurations between two runs of sentinel configuration. Zero disables sentinel.
+      * @param driftThreshold Maximum relative difference of sentinel duration from its initial value, eg. 0.1 for 10%. Zero disables sentinel.
+      * @param loadThreshold Maximum fraction of host CPU time used by other processes during measurement, eg. 0.25 when one core out of four
+      * is fully used. Zero disables monitoring of host load, which is only available on systems which provide /proc file system.
+      */
+    void setInterferenceDetection(const size_t sentinelInterval, const double driftThreshold, const double loadThreshold);
+
+    /** @fn void setCompilationLookahead(const size_t count)
+      * Enables compilation of upcoming configurations in background while the current configuration is running. Compiled programs are
+      * handed over to the kernel cache, so the cache must not be disabled with setKernelCacheCapacity() method. Only searchers which know the
+      * order of upcoming configurations in advance benefit from this option, eg. full search, random search or custom searchers which override
+      * Searcher::getUpcomingConfigurationIndices() method. Number of programs compiled concurrently is limited by setCompilationThreadCount()
+      * method. By default, background compilation is disabled.
+      * @param count Number of upcoming configurations which are compiled in background. Zero disables background compilation.
+      */
+    void setCompilationLookahead(const size_t count);
+
+    /** @fn void setSpeculativeCompilation(const size_t candidateCount)
+      * Enables speculative compilation of configurations which are likely to be explored next, eg. neighbours of current state for simulated
+      * annealing or Markov chain Monte Carlo searchers. Candidates are compiled only when compilation threads are not busy with upcoming
+      * configurations, see setCompilationLookahead() method. At most specified number of speculatively compiled programs is kept, the oldest
+      * unused ones are discarded. Custom searchers can provide candidates by overriding Searcher::getLikelyConfigurationIndices() method.
+      * Speculative compilation requires kernel cache to be enabled. By default, speculative compilation is disabled.
+      * @param candidateCount Number of candidate configurations which are compiled speculatively for each tested configuration. Zero disables
+      * speculative compilation.
+      */
+    void setSpeculativeCompilation(const size_t candidateCount);
+
+    /** @fn void addObjective(const KernelId id, const ObjectiveMetric metric, const double weight,
+      * const double limit = std::numeric_limits<double>::max())
+      * Adds built-in tuning objective for specified kernel or kernel composition. Once at least one objective is added, the best configuration
+      * is the one with the lowest weighted sum of objective values among configurations which satisfy limits of all objectives. Searchers
+      * minimize the same weighted sum, see ComputationResult::getObjectiveValue(). Computation duration is not included in the weighted sum
+      * unless it is added as an objective as well. Adding an objective clears the best configuration and Pareto front found so far.
+      * @param id Id of kernel or kernel composition for which the objective will be added.
+      * @param metric Metric used as the objective. See ::ObjectiveMetric for more information.
+      * @param weight Weight of the objective inside weighted sum. Weight equal to zero means that the objective only constrains the result
+      * and is tracked in Pareto front.
+      * @param limit Maximum allowed value of the objective. Configurations which exceed it are never selected as the best configuration.
+      */
+    void addObjective(const KernelId id, const ObjectiveMetric metric, const double weight,
+        const double limit = std::numeric_limits<double>::max());
+
+    /** @fn void addObjective(const KernelId id, const std::string& name, const std::function<double(const ComputationResult&)>& metric,
+      * const double weight, const double limit = std::numeric_limits<double>::max())
+      * Adds custom tuning objective for specified kernel or kernel composition, eg. energy consumption or achieved bandwidth measured by the
+      * user. Smaller objective values are considered better. Otherwise behaves the same as the built-in objective variant of this method.
+      * @param id Id of kernel or kernel composition for which the objective will be added.
+      * @param name Unique name of the objective, used as a key in ComputationResult::getObjectiveValues().
+      * @param metric Function which computes value of the objective from result of successful computation.
+      * @param weight Weight of the objective inside weighted sum.
+      * @param limit Maximum allowed value of the objective.
+      */
+    void addObjective(const KernelId id, const std::string& name, const std::function<double(const ComputationResult&)>& metric,
+        const double weight, const double limit = std::numeric_limits<double>::max());
+
+    /** @fn void clearObjectives(const KernelId id)
+      * Removes all tuning objectives added for specified kernel or kernel composition. Afterwards, configurations are compared by computation
+      * duration only. Clears the best configuration and Pareto front found so far.
+      * @param id Id of kernel or kernel composition for which the objectives will be removed.
+      */
+    void clearObjectives(const KernelId id);
+
     /** @fn void setPrintingTimeUnit(const TimeUnit unit)
       * Sets time unit used for printing of results. Default time unit is milliseconds. 
       * @param unit Time unit which will be used for printing of results. See ::TimeUnit for more information.
@@ -549,6 +740,15 @@ public:
       */
     ComputationResult getBestComputationResult(const KernelId id) const;
 
+    /** @fn std::vector<ComputationResult> getParetoFront(const KernelId id) const
+      * Returns computation results which are not dominated by any other result found for specified kernel. Result dominates another result if
+      * it is not worse in any tuning objective and better in at least one of them. Only results which satisfy limits of all objectives are
+      * considered. If no tuning objectives were added, computation duration is the only objective.
+      * @param id Id of kernel for which the Pareto front will be returned.
+      * @return Computation results forming Pareto front for specified kernel. See ComputationResult for more information.
+      */
+    std::vector<ComputationResult> getParetoFront(const KernelId id) const;
+
     /** @fn std::string getKernelSource(const KernelId id, const std::vector<ParameterPair>& configuration) const
       * Returns kernel source with preprocessor definitions for specified kernel based on provided configuration.
       * @param id Id of kernel for which the source is returned.
@@ -593,10 +793,19 @@ public:
       * Default tolerance threshold is 1e-4.
       * @param method Validation method which will be used for floating-point argument validation. See ::ValidationMethod for more information.
       * @param toleranceThreshold Output validation threshold. If difference between tuned kernel output and reference output is within tolerance
-      * threshold, the tuned kernel output will be considered correct.
+      * threshold, the tuned kernel output will be considered correct. Threshold of side by side comparison in units in the last place has to
+      * be an integer.
       */
     void setValidationMethod(const ValidationMethod method, const double toleranceThreshold);
 
+    /** @fn void setRelativeValidationFloor(const double floor)
+      * Sets absolute difference below which elements are always considered correct during side by side relative comparison. This prevents
+      * reporting large relative differences of elements whose reference values are close to zero. Default floor is 1e-4.
+      * @param floor Absolute difference which has to be exceeded before relative difference of elements is compared to tolerance threshold.
+      * Cannot be negative or NaN.
+      */
+    void setRelativeValidationFloor(const double floor);
+
     /** @fn void setValidationRange(const ArgumentId id, const size_t range)
       * Sets validation range for specified argument to specified validation range. Only elements within validation range, starting with the first
       * element, will be validated. All elements are validated by default.
@@ -608,12 +817,25 @@ public:
     /** @fn void setArgumentComparator(const ArgumentId id, const std::function<bool(const void*, const void*)>& comparator)
       * Sets argument comparator for specified kernel argument. Arguments with custom data type cannot be compared using built-in comparison
       * operators and require user to provide a comparator. Comparator can also be optionally added for arguments with built-in data types.
+      * When asynchronous validation is enabled, the comparator is called from a separate host thread, see setAsynchronousValidation() method.
       * @param id Id of argument for which the comparator will be set.
       * @param comparator Function which receives two elements with data type matching the data type of specified kernel argument and returns true
       * if the elements are equal. Returns false otherwise.
       */
     void setArgumentComparator(const ArgumentId id, const std::function<bool(const void*, const void*)>& comparator);
 
+    /** @fn void setAsynchronousValidation(const bool flag)
+      * Enables validation of kernel output on a separate host thread during kernel tuning performed with tuneKernel() method. Output of each
+      * configuration is downloaded right after its run and compared with reference result while the next configuration is running. Searcher
+      * and stop condition receive provisional result which is considered correct. Provisional result is not used as the best duration for
+      * measurement racing and adaptive measurement until its validation completes. Configurations whose output turns out to be incorrect are
+      * marked as invalid in the returned and printed results and cannot be selected as the best configuration, but searcher is not informed
+      * about the failure. Argument comparators set with setArgumentComparator() method are called from the validation thread, so they have to
+      * be thread-safe. By default, validation is performed synchronously.
+      * @param flag If true, kernel output is validated asynchronously during kernel tuning.
+      */
+    void setAsynchronousValidation(const bool flag);
+
     /** @fn void setCompilerOptions(const std::string& options)
       * Sets compute API compiler options to specified options. There are no default options for OpenCL back-end. Default option for CUDA
       * back-end is "--gpu-architecture=compute_30".
@@ -624,14 +846,63 @@ public:
       */
     void setCompilerOptions(const std::string& options);
 
+    /** @fn void setParameterDefinitionsAsCompilerOptions(const bool flag)
+      * Toggles passing of kernel parameters to compiler as -D options instead of preprocessor definitions prepended to kernel source code.
+      * Kernel source then stays the same for all configurations and parameter values are appended to compiler options specified with
+      * setCompilerOptions() method. Vulkan back-end always passes parameters as compiler definitions, so this setting has no effect on it.
+      * By default, parameters are prepended to kernel source code.
+      * @param flag If true, kernel parameters are passed as compiler options. Otherwise, they are prepended to kernel source code.
+      */
+    void setParameterDefinitionsAsCompilerOptions(const bool flag);
+
+    /** @fn void setSpecializationConstantUsage(const bool flag)
+      * Toggles passing of integer kernel parameters as SPIR-V specialization constants. Only supported by Vulkan back-end. Shader is then
+      * compiled only once for each combination of local size and floating-point parameters and configurations differ only in created
+      * compute pipeline. Instead of parameter value, macro with name of the parameter followed by "_CONSTANT_ID" is defined for each integer
+      * parameter, shader has to declare the parameter as specialization constant, e.g.,
+      * "layout(constant_id = PARAM_CONSTANT_ID) const uint PARAM = 1;". Values are passed as 32-bit integers. Parameters which are used in
+      * preprocessor directives cannot be passed this way. By default, all parameters are passed as compiler definitions.
+      * @param flag If true, integer kernel parameters are passed as specialization constants. Otherwise, they are passed as compiler
+      * definitions.
+      */
+    void setSpecializationConstantUsage(const bool flag);
+
     /** @fn void setKernelCacheCapacity(const size_t capacity)
       * Sets capacity of kernel cache inside the tuner. The cache contains recently compiled kernels which are prepared to be launched immidiately,
       * eliminating compilation overhead. Using the cache can significantly improve tuner performance during online tuning or iterative kernel
-      * running with TuningManipulator. Default cache size is 10.
+      * running with TuningManipulator. When the cache is full, the least recently used kernel is evicted. Default cache size is 10.
       * @param capacity Controls kernel cache capacity. If zero, kernel cache is completely disabled.
       */
     void setKernelCacheCapacity(const size_t capacity);
 
+    /** @fn KernelCacheStatistics getKernelCacheStatistics() const
+      * Retrieves usage statistics of kernel cache, eg. number of cache hits, misses and evictions. When the cache is full, the least recently
+      * used kernel is evicted. Statistics can be used to choose suitable cache capacity with setKernelCacheCapacity() method. See
+      * KernelCacheStatistics for more information.
+      * @return Usage statistics of kernel cache.
+      */
+    KernelCacheStatistics getKernelCacheStatistics() const;
+
+    /** @fn void setCompilationThreadCount(const size_t count)
+      * Sets number of threads which compile kernels in background, see setCompilationLookahead() method. Programs for distinct configurations
+      * are compiled concurrently, up to specified number at once. Default number of threads is equal to number of hardware threads on host.
+      * @param count Number of compilation threads. Must be greater than zero.
+      */
+    void setCompilationThreadCount(const size_t count);
+
+    /** @fn void setPersistentKernelCache(const std::string& directory, const size_t maximumSize)
+      * Enables persistent cache of compiled programs, which is stored in specified directory and shared between tuner runs. Cached programs
+      * are keyed by device, driver version, compiler options and kernel source, so they are never reused with different inputs. OpenCL
+      * program binaries, CUDA PTX and Vulkan SPIR-V are stored. Compilation failures reported by compiler diagnostics are stored as well,
+      * so that programs which are known to fail are rejected without compilation in subsequent runs. Other build failures, eg. lack of
+      * resources, are not stored. When total size of cached programs exceeds the limit, the least recently used ones are removed. The
+      * directory can be shared by multiple tuner processes at once, access to it is serialized with a lock file. By default, persistent
+      * cache is disabled.
+      * @param directory Existing directory where compiled programs will be stored. If empty, persistent cache is disabled.
+      * @param maximumSize Maximum total size of cached programs in bytes.
+      */
+    void setPersistentKernelCache(const std::string& directory, const size_t maximumSize);
+
     /** @fn void printComputeAPIInfo(std::ostream& outputTarget) const
       * Prints basic information about available platforms and devices to specified output stream. Also prints indices assigned to them
       * by KTT framework.
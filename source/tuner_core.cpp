@@ -91,6 +91,11 @@ void TunerCore::addParameterPack(const KernelId id, const std::string& packName,
     kernelManager.addParameterPack(id, packName, parameterNames);
 }
 
+void TunerCore::setHostOnlyParameters(const KernelId id, const std::vector<std::string>& parameterNames)
+{
+    kernelManager.setHostOnlyParameters(id, parameterNames);
+}
+
 void TunerCore::setThreadModifier(const KernelId id, const ModifierType modifierType, const ModifierDimension modifierDimension,
     const std::vector<std::string>& parameterNames, const std::function<size_t(const size_t, const std::vector<size_t>&)>& modifierFunction)
 {
@@ -242,6 +247,11 @@ void TunerCore::setValidationMethod(const ValidationMethod method, const double
     kernelRunner->setValidationMethod(method, toleranceThreshold);
 }
 
+void TunerCore::setRelativeValidationFloor(const double floor)
+{
+    kernelRunner->setRelativeValidationFloor(floor);
+}
+
 void TunerCore::setValidationMode(const ValidationMode mode)
 {
     kernelRunner->setValidationMode(mode);
@@ -335,11 +345,108 @@ void TunerCore::setSearchMethod(const SearchMethod method, const std::vector<dou
     tuningRunner->setSearchMethod(method, arguments);
 }
 
+void TunerCore::setSearcher(const KernelId id, std::unique_ptr<Searcher> searcher)
+{
+    if (!kernelManager.isKernel(id) && !kernelManager.isComposition(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+
+    tuningRunner->setSearcher(id, std::move(searcher));
+}
+
+void TunerCore::setWarmStart(const KernelId id, const std::vector<std::string>& filePaths, const size_t seedCount)
+{
+    if (!kernelManager.isKernel(id) && !kernelManager.isComposition(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+
+    tuningRunner->setWarmStart(id, filePaths, seedCount);
+}
+
+void TunerCore::setMeasurementRepetitions(const size_t warmUpRuns, const size_t timedRuns)
+{
+    kernelRunner->setMeasurementRepetitions(warmUpRuns, timedRuns);
+}
+
+void TunerCore::setMeasurementStatistic(const MeasurementStatistic statistic)
+{
+    kernelRunner->setMeasurementStatistic(statistic);
+}
+
+void TunerCore::setAdaptiveMeasurement(const double relativeConfidenceInterval, const size_t maximumTimedRuns)
+{
+    kernelRunner->setAdaptiveMeasurement(relativeConfidenceInterval, maximumTimedRuns);
+}
+
+void TunerCore::setMeasurementRacing(const double factor)
+{
+    kernelRunner->setMeasurementRacing(factor);
+}
+
+void TunerCore::setFinalistRemeasurement(const size_t finalistCount, const size_t rounds)
+{
+    tuningRunner->setFinalistRemeasurement(finalistCount, rounds);
+}
+
+void TunerCore::setInterferenceDetection(const size_t sentinelInterval, const double driftThreshold, const double loadThreshold)
+{
+    tuningRunner->setInterferenceDetection(sentinelInterval, driftThreshold, loadThreshold);
+}
+
+void TunerCore::setCompilationLookahead(const size_t count)
+{
+    tuningRunner->setCompilationLookahead(count);
+}
+
+void TunerCore::setSpeculativeCompilation(const size_t candidateCount)
+{
+    tuningRunner->setSpeculativeCompilation(candidateCount);
+    computeEngine->setSpeculativeCacheCapacity(candidateCount);
+}
+
+void TunerCore::setAsynchronousValidation(const bool flag)
+{
+    tuningRunner->setAsynchronousValidation(flag);
+}
+
+void TunerCore::addObjective(const KernelId id, const ObjectiveMetric metric, const double weight, const double limit)
+{
+    if (!kernelManager.isKernel(id) && !kernelManager.isComposition(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+
+    tuningRunner->addObjective(id, TuningObjective(metric, weight, limit));
+}
+
+void TunerCore::addObjective(const KernelId id, const std::string& name, const std::function<double(const ComputationResult&)>& metric,
+    const double weight, const double limit)
+{
+    if (!kernelManager.isKernel(id) && !kernelManager.isComposition(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+
+    tuningRunner->addObjective(id, TuningObjective(name, metric, weight, limit));
+}
+
+void TunerCore::clearObjectives(const KernelId id)
+{
+    tuningRunner->clearObjectives(id);
+}
+
 ComputationResult TunerCore::getBestComputationResult(const KernelId id) const
 {
     return tuningRunner->getBestComputationResult(id);
 }
 
+std::vector<ComputationResult> TunerCore::getParetoFront(const KernelId id) const
+{
+    return tuningRunner->getParetoFront(id);
+}
+
 void TunerCore::setPrintingTimeUnit(const TimeUnit unit)
 {
     kernelRunner->setTimeUnit(unit);
@@ -366,6 +473,16 @@ void TunerCore::setCompilerOptions(const std::string& options)
     computeEngine->setCompilerOptions(options);
 }
 
+void TunerCore::setParameterDefinitionsAsCompilerOptions(const bool flag)
+{
+    kernelRunner->setParameterDefinitionsAsCompilerOptions(flag);
+}
+
+void TunerCore::setSpecializationConstantUsage(const bool flag)
+{
+    computeEngine->setSpecializationConstantUsage(flag);
+}
+
 void TunerCore::setGlobalSizeType(const GlobalSizeType type)
 {
     computeEngine->setGlobalSizeType(type);
@@ -389,6 +506,21 @@ void TunerCore::setKernelCacheCapacity(const size_t capacity)
     computeEngine->setKernelCacheCapacity(capacity);
 }
 
+KernelCacheStatistics TunerCore::getKernelCacheStatistics() const
+{
+    return computeEngine->getKernelCacheStatistics();
+}
+
+void TunerCore::setCompilationThreadCount(const size_t count)
+{
+    computeEngine->setCompilationThreadCount(count);
+}
+
+void TunerCore::setPersistentKernelCache(const std::string& directory, const size_t maximumSize)
+{
+    computeEngine->setPersistentKernelCache(directory, maximumSize);
+}
+
 void TunerCore::persistArgument(const ArgumentId id, const bool flag)
 {
     argumentManager.setPersistentFlag(id, flag);
@@ -396,6 +528,16 @@ void TunerCore::persistArgument(const ArgumentId id, const bool flag)
     computeEngine->persistArgument(argument, flag);
 }
 
+void TunerCore::setArgumentSnapshotUsage(const bool flag)
+{
+    computeEngine->setArgumentSnapshotUsage(flag);
+}
+
+void TunerCore::setPinnedStagingUsage(const bool flag)
+{
+    computeEngine->setPinnedStagingUsage(flag);
+}
+
 void TunerCore::downloadPersistentArgument(const OutputDescriptor& output) const
 {
     computeEngine->downloadArgument(output.getArgumentId(), output.getOutputDestination(), output.getOutputSizeInBytes());
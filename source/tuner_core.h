@@ -1,10 +1,13 @@
 #pragma once
 
 #include <fstream>
+#include <functional>
 #include <memory>
 #include <vector>
 #include <compute_engine/compute_engine.h>
 #include <enum/compute_api.h>
+#include <enum/measurement_statistic.h>
+#include <enum/objective_metric.h>
 #include <kernel/kernel_manager.h>
 #include <kernel_argument/argument_manager.h>
 #include <tuning_runner/kernel_runner.h>
@@ -33,6 +36,7 @@ public:
     void addConstraint(const KernelId id, const std::vector<std::string>& parameterNames,
         const std::function<bool(const std::vector<size_t>&)>& constraintFunction);
     void addParameterPack(const KernelId id, const std::string& packName, const std::vector<std::string>& parameterNames);
+    void setHostOnlyParameters(const KernelId id, const std::vector<std::string>& parameterNames);
     void setThreadModifier(const KernelId id, const ModifierType modifierType, const ModifierDimension modifierDimension,
         const std::vector<std::string>& parameterNames, const std::function<size_t(const size_t, const std::vector<size_t>&)>& modifierFunction);
     void setLocalMemoryModifier(const KernelId id, const ArgumentId argumentId, const std::vector<std::string>& parameterNames,
@@ -59,6 +63,7 @@ public:
     void setTuningManipulator(const KernelId id, std::unique_ptr<TuningManipulator> manipulator);
     void setTuningManipulatorSynchronization(const KernelId id, const bool flag);
     void setValidationMethod(const ValidationMethod method, const double toleranceThreshold);
+    void setRelativeValidationFloor(const double floor);
     void setValidationMode(const ValidationMode mode);
     void setValidationRange(const ArgumentId id, const size_t range);
     void setArgumentComparator(const ArgumentId id, const std::function<bool(const void*, const void*)>& comparator);
@@ -73,7 +78,23 @@ public:
     void clearKernelData(const KernelId id, const bool clearConfigurations);
     void setKernelProfiling(const bool flag);
     void setSearchMethod(const SearchMethod method, const std::vector<double>& arguments);
+    void setSearcher(const KernelId id, std::unique_ptr<Searcher> searcher);
+    void setWarmStart(const KernelId id, const std::vector<std::string>& filePaths, const size_t seedCount);
+    void setMeasurementRepetitions(const size_t warmUpRuns, const size_t timedRuns);
+    void setMeasurementStatistic(const MeasurementStatistic statistic);
+    void setAdaptiveMeasurement(const double relativeConfidenceInterval, const size_t maximumTimedRuns);
+    void setMeasurementRacing(const double factor);
+    void setFinalistRemeasurement(const size_t finalistCount, const size_t rounds);
+    void setInterferenceDetection(const size_t sentinelInterval, const double driftThreshold, const double loadThreshold);
+    void setCompilationLookahead(const size_t count);
+    void setSpeculativeCompilation(const size_t candidateCount);
+    void setAsynchronousValidation(const bool flag);
+    void addObjective(const KernelId id, const ObjectiveMetric metric, const double weight, const double limit);
+    void addObjective(const KernelId id, const std::string& name, const std::function<double(const ComputationResult&)>& metric,
+        const double weight, const double limit);
+    void clearObjectives(const KernelId id);
     ComputationResult getBestComputationResult(const KernelId id) const;
+    std::vector<ComputationResult> getParetoFront(const KernelId id) const;
     void setPrintingTimeUnit(const TimeUnit unit);
     void setInvalidResultPrinting(const bool flag);
     void printResult(const KernelId id, std::ostream& outputTarget, const PrintFormat format) const;
@@ -81,10 +102,17 @@ public:
 
     // Compute engine methods
     void setCompilerOptions(const std::string& options);
+    void setParameterDefinitionsAsCompilerOptions(const bool flag);
+    void setSpecializationConstantUsage(const bool flag);
     void setGlobalSizeType(const GlobalSizeType type);
     void setAutomaticGlobalSizeCorrection(const bool flag);
     void setKernelCacheCapacity(const size_t capacity);
+    void setCompilationThreadCount(const size_t count);
+    void setPersistentKernelCache(const std::string& directory, const size_t maximumSize);
+    KernelCacheStatistics getKernelCacheStatistics() const;
     void persistArgument(const ArgumentId id, const bool flag);
+    void setArgumentSnapshotUsage(const bool flag);
+    void setPinnedStagingUsage(const bool flag);
     void downloadPersistentArgument(const OutputDescriptor& output) const;
     void printComputeAPIInfo(std::ostream& outputTarget) const;
     std::vector<PlatformInfo> getPlatformInfo() const;
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ktt
+{
+
+// Summary of differences between result and reference elements, distances in units in the last place are saturated to the maximum value
+// of unsigned integer with the same width as compared elements, distances of NaN elements are always saturated and exceed any threshold
+struct ComparisonStatistics
+{
+    uint64_t maximumUlpDistance;
+    double maximumDifference;
+    double squaredDifferenceSum;
+    size_t withinToleranceCount;
+};
+
+// Kernels which compare a block of result elements with reference elements. Half precision elements are passed as raw 16-bit values, so that
+// translation units compiled with vector instruction sets do not instantiate any inline functions shared with the rest of the library.
+template <typename T>
+struct ComparisonKernels
+{
+    // Returns sum of absolute differences of all elements
+    double (*sumAbsoluteDifferences)(const T* result, const T* reference, const size_t count);
+
+    // Return index of the first element which exceeds the threshold or number of elements if there is no such element, relative differences
+    // are computed against absolute value of reference element and differences which do not exceed the floor are ignored
+    size_t (*findAbsoluteMismatch)(const T* result, const T* reference, const size_t count, const double threshold);
+    size_t (*findRelativeMismatch)(const T* result, const T* reference, const size_t count, const double threshold, const double floor);
+    size_t (*findUlpMismatch)(const T* result, const T* reference, const size_t count, const uint64_t threshold);
+
+    // Adds differences of all elements to statistics in a single pass, element is within tolerance if its absolute difference does not exceed
+    // the tolerance or its distance in units in the last place does not exceed the ULP tolerance
+    void (*accumulateStatistics)(const T* result, const T* reference, const size_t count, const double tolerance, const uint64_t ulpTolerance,
+        ComparisonStatistics& statistics);
+};
+
+struct ComparisonKernelSet
+{
+    ComparisonKernels<float> floatKernels;
+    ComparisonKernels<double> doubleKernels;
+    ComparisonKernels<uint16_t> halfKernels;
+};
+
+ComparisonKernelSet getScalarComparisonKernels();
+ComparisonKernelSet getAvx2ComparisonKernels();
+ComparisonKernelSet getAvx512ComparisonKernels();
+
+} // namespace ktt
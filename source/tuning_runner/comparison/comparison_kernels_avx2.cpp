@@ -0,0 +1,287 @@
+// This file is compiled with AVX2 and F16C instructions enabled, kernels are only selected on processors which support them
+#include <immintrin.h>
+#include <tuning_runner/comparison/comparison_kernels_simd.h>
+
+namespace ktt
+{
+
+namespace
+{
+
+struct Avx2
+{
+    using FloatVector = __m256;
+    using DoubleVector = __m256d;
+    using IntegerVector = __m256i;
+
+    // Operations on integer lanes with the same width as single precision lanes
+    struct Lanes32
+    {
+        static const uint64_t maximumValue = 0xffffffffULL;
+
+        static IntegerVector broadcast(const uint64_t value)
+        {
+            return _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(value)));
+        }
+
+        static IntegerVector getDistance(const IntegerVector& first, const IntegerVector& second, const IntegerVector& signMask)
+        {
+            const IntegerVector firstOrdered = getOrdered(first, signMask);
+            const IntegerVector secondOrdered = getOrdered(second, signMask);
+            const IntegerVector difference = _mm256_sub_epi32(firstOrdered, secondOrdered);
+            const IntegerVector negative = _mm256_cmpgt_epi32(secondOrdered, firstOrdered);
+            return _mm256_sub_epi32(_mm256_xor_si256(difference, negative), negative);
+        }
+
+        static IntegerVector saturateNan(const IntegerVector& distance, const FloatVector& first, const FloatVector& second)
+        {
+            return _mm256_or_si256(distance, _mm256_castps_si256(_mm256_cmp_ps(first, second, _CMP_UNORD_Q)));
+        }
+
+        static unsigned greaterMask(const IntegerVector& vector, const IntegerVector& threshold)
+        {
+            const IntegerVector bias = _mm256_set1_epi32(static_cast<int>(0x80000000u));
+            const IntegerVector greater = _mm256_cmpgt_epi32(_mm256_xor_si256(vector, bias), _mm256_xor_si256(threshold, bias));
+            return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(greater)));
+        }
+
+        static IntegerVector maximum(const IntegerVector& first, const IntegerVector& second)
+        {
+            return _mm256_max_epu32(first, second);
+        }
+
+        static uint64_t reduceMaximum(const IntegerVector& vector)
+        {
+            uint32_t values[8];
+            _mm256_storeu_si256(reinterpret_cast<IntegerVector*>(values), vector);
+            uint32_t result = 0;
+
+            for (const uint32_t value : values)
+            {
+                result = value > result ? value : result;
+            }
+
+            return result;
+        }
+
+    private:
+        static IntegerVector getOrdered(const IntegerVector& bits, const IntegerVector& signMask)
+        {
+            const IntegerVector magnitude = _mm256_andnot_si256(signMask, bits);
+            const IntegerVector negative = _mm256_cmpeq_epi32(_mm256_and_si256(bits, signMask), signMask);
+            return _mm256_sub_epi32(_mm256_xor_si256(magnitude, negative), negative);
+        }
+    };
+
+    // Operations on integer lanes with the same width as double precision lanes, AVX2 has no unsigned 64-bit comparison, so it is emulated
+    // with biased signed comparison
+    struct Lanes64
+    {
+        static const uint64_t maximumValue = 0xffffffffffffffffULL;
+
+        static IntegerVector broadcast(const uint64_t value)
+        {
+            return _mm256_set1_epi64x(static_cast<long long>(value));
+        }
+
+        static IntegerVector getDistance(const IntegerVector& first, const IntegerVector& second, const IntegerVector& signMask)
+        {
+            const IntegerVector firstOrdered = getOrdered(first, signMask);
+            const IntegerVector secondOrdered = getOrdered(second, signMask);
+            const IntegerVector difference = _mm256_sub_epi64(firstOrdered, secondOrdered);
+            const IntegerVector negative = _mm256_cmpgt_epi64(secondOrdered, firstOrdered);
+            return _mm256_sub_epi64(_mm256_xor_si256(difference, negative), negative);
+        }
+
+        static IntegerVector saturateNan(const IntegerVector& distance, const DoubleVector& first, const DoubleVector& second)
+        {
+            return _mm256_or_si256(distance, _mm256_castpd_si256(_mm256_cmp_pd(first, second, _CMP_UNORD_Q)));
+        }
+
+        static unsigned greaterMask(const IntegerVector& vector, const IntegerVector& threshold)
+        {
+            return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(getGreater(vector, threshold))));
+        }
+
+        static IntegerVector maximum(const IntegerVector& first, const IntegerVector& second)
+        {
+            return _mm256_blendv_epi8(second, first, getGreater(first, second));
+        }
+
+        static uint64_t reduceMaximum(const IntegerVector& vector)
+        {
+            uint64_t values[4];
+            _mm256_storeu_si256(reinterpret_cast<IntegerVector*>(values), vector);
+            uint64_t result = 0;
+
+            for (const uint64_t value : values)
+            {
+                result = value > result ? value : result;
+            }
+
+            return result;
+        }
+
+    private:
+        static IntegerVector getOrdered(const IntegerVector& bits, const IntegerVector& signMask)
+        {
+            const IntegerVector magnitude = _mm256_andnot_si256(signMask, bits);
+            const IntegerVector negative = _mm256_cmpeq_epi64(_mm256_and_si256(bits, signMask), signMask);
+            return _mm256_sub_epi64(_mm256_xor_si256(magnitude, negative), negative);
+        }
+
+        static IntegerVector getGreater(const IntegerVector& first, const IntegerVector& second)
+        {
+            const IntegerVector bias = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ULL));
+            return _mm256_cmpgt_epi64(_mm256_xor_si256(first, bias), _mm256_xor_si256(second, bias));
+        }
+    };
+
+    static size_t getWidth(const FloatVector&)
+    {
+        return 8;
+    }
+
+    static size_t getWidth(const DoubleVector&)
+    {
+        return 4;
+    }
+
+    static FloatVector load(const float* data)
+    {
+        return _mm256_loadu_ps(data);
+    }
+
+    static FloatVector load(const uint16_t* data)
+    {
+        return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+    }
+
+    static DoubleVector load(const double* data)
+    {
+        return _mm256_loadu_pd(data);
+    }
+
+    static IntegerVector loadBits(const float* data)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const IntegerVector*>(data));
+    }
+
+    static IntegerVector loadBits(const uint16_t* data)
+    {
+        return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+    }
+
+    static IntegerVector loadBits(const double* data)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const IntegerVector*>(data));
+    }
+
+    static FloatVector broadcast(const float value)
+    {
+        return _mm256_set1_ps(value);
+    }
+
+    static DoubleVector broadcast(const double value)
+    {
+        return _mm256_set1_pd(value);
+    }
+
+    static FloatVector absoluteDifference(const FloatVector& first, const FloatVector& second)
+    {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), _mm256_sub_ps(first, second));
+    }
+
+    static DoubleVector absoluteDifference(const DoubleVector& first, const DoubleVector& second)
+    {
+        return _mm256_andnot_pd(_mm256_set1_pd(-0.0), _mm256_sub_pd(first, second));
+    }
+
+    static DoubleVector lowerHalf(const FloatVector& vector)
+    {
+        return _mm256_cvtps_pd(_mm256_castps256_ps128(vector));
+    }
+
+    static DoubleVector upperHalf(const FloatVector& vector)
+    {
+        return _mm256_cvtps_pd(_mm256_extractf128_ps(vector, 1));
+    }
+
+    static DoubleVector add(const DoubleVector& first, const DoubleVector& second)
+    {
+        return _mm256_add_pd(first, second);
+    }
+
+    static DoubleVector multiply(const DoubleVector& first, const DoubleVector& second)
+    {
+        return _mm256_mul_pd(first, second);
+    }
+
+    static double sum(const DoubleVector& vector)
+    {
+        const __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(vector), _mm256_extractf128_pd(vector, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+    }
+
+    static unsigned greaterMask(const FloatVector& vector, const FloatVector& threshold)
+    {
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(vector, threshold, _CMP_GT_OQ)));
+    }
+
+    static unsigned greaterMask(const DoubleVector& vector, const DoubleVector& threshold)
+    {
+        return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(vector, threshold, _CMP_GT_OQ)));
+    }
+
+    static unsigned lessEqualMask(const FloatVector& vector, const FloatVector& threshold)
+    {
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(vector, threshold, _CMP_LE_OQ)));
+    }
+
+    static unsigned lessEqualMask(const DoubleVector& vector, const DoubleVector& threshold)
+    {
+        return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(vector, threshold, _CMP_LE_OQ)));
+    }
+
+    // Maximum ignores NaN differences, they are reflected in distances in units in the last place
+    static FloatVector maximum(const FloatVector& accumulator, const FloatVector& vector)
+    {
+        return _mm256_max_ps(vector, accumulator);
+    }
+
+    static DoubleVector maximum(const DoubleVector& accumulator, const DoubleVector& vector)
+    {
+        return _mm256_max_pd(vector, accumulator);
+    }
+
+    static double reduceMaximum(const FloatVector& vector)
+    {
+        const __m128 quad = _mm_max_ps(_mm256_castps256_ps128(vector), _mm256_extractf128_ps(vector, 1));
+        const __m128 pair = _mm_max_ps(quad, _mm_movehl_ps(quad, quad));
+        return _mm_cvtss_f32(_mm_max_ss(pair, _mm_shuffle_ps(pair, pair, 1)));
+    }
+
+    static double reduceMaximum(const DoubleVector& vector)
+    {
+        const __m128d pair = _mm_max_pd(_mm256_castpd256_pd128(vector), _mm256_extractf128_pd(vector, 1));
+        return _mm_cvtsd_f64(_mm_max_sd(pair, _mm_unpackhi_pd(pair, pair)));
+    }
+
+    static unsigned relativeMask(const DoubleVector& difference, const DoubleVector& reference, const DoubleVector& floor,
+        const DoubleVector& threshold)
+    {
+        const __m256d aboveFloor = _mm256_cmp_pd(difference, floor, _CMP_GT_OQ);
+        const __m256d absoluteReference = _mm256_andnot_pd(_mm256_set1_pd(-0.0), reference);
+        const __m256d aboveThreshold = _mm256_cmp_pd(_mm256_div_pd(difference, absoluteReference), threshold, _CMP_GT_OQ);
+        return static_cast<unsigned>(_mm256_movemask_pd(_mm256_and_pd(aboveFloor, aboveThreshold)));
+    }
+};
+
+} // namespace
+
+ComparisonKernelSet getAvx2ComparisonKernels()
+{
+    return getSimdComparisonKernels<Avx2>();
+}
+
+} // namespace ktt
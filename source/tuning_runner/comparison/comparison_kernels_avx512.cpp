@@ -0,0 +1,253 @@
+// This file is compiled with AVX-512 Foundation instructions enabled, kernels are only selected on processors which support them
+#include <immintrin.h>
+#include <tuning_runner/comparison/comparison_kernels_simd.h>
+
+namespace ktt
+{
+
+namespace
+{
+
+struct Avx512
+{
+    using FloatVector = __m512;
+    using DoubleVector = __m512d;
+    using IntegerVector = __m512i;
+
+    // Operations on integer lanes with the same width as single precision lanes
+    struct Lanes32
+    {
+        static const uint64_t maximumValue = 0xffffffffULL;
+
+        static IntegerVector broadcast(const uint64_t value)
+        {
+            return _mm512_set1_epi32(static_cast<int>(static_cast<uint32_t>(value)));
+        }
+
+        static IntegerVector getDistance(const IntegerVector& first, const IntegerVector& second, const IntegerVector& signMask)
+        {
+            const IntegerVector firstOrdered = getOrdered(first, signMask);
+            const IntegerVector secondOrdered = getOrdered(second, signMask);
+            const IntegerVector difference = _mm512_sub_epi32(firstOrdered, secondOrdered);
+            const __mmask16 negative = _mm512_cmpgt_epi32_mask(secondOrdered, firstOrdered);
+            return _mm512_mask_sub_epi32(difference, negative, _mm512_setzero_si512(), difference);
+        }
+
+        static IntegerVector saturateNan(const IntegerVector& distance, const FloatVector& first, const FloatVector& second)
+        {
+            return _mm512_mask_mov_epi32(distance, _mm512_cmp_ps_mask(first, second, _CMP_UNORD_Q), _mm512_set1_epi32(-1));
+        }
+
+        static unsigned greaterMask(const IntegerVector& vector, const IntegerVector& threshold)
+        {
+            return static_cast<unsigned>(_mm512_cmpgt_epu32_mask(vector, threshold));
+        }
+
+        static IntegerVector maximum(const IntegerVector& first, const IntegerVector& second)
+        {
+            return _mm512_max_epu32(first, second);
+        }
+
+        static uint64_t reduceMaximum(const IntegerVector& vector)
+        {
+            return _mm512_reduce_max_epu32(vector);
+        }
+
+    private:
+        static IntegerVector getOrdered(const IntegerVector& bits, const IntegerVector& signMask)
+        {
+            const IntegerVector magnitude = _mm512_andnot_si512(signMask, bits);
+            return _mm512_mask_sub_epi32(magnitude, _mm512_test_epi32_mask(bits, signMask), _mm512_setzero_si512(), magnitude);
+        }
+    };
+
+    // Operations on integer lanes with the same width as double precision lanes
+    struct Lanes64
+    {
+        static const uint64_t maximumValue = 0xffffffffffffffffULL;
+
+        static IntegerVector broadcast(const uint64_t value)
+        {
+            return _mm512_set1_epi64(static_cast<long long>(value));
+        }
+
+        static IntegerVector getDistance(const IntegerVector& first, const IntegerVector& second, const IntegerVector& signMask)
+        {
+            const IntegerVector firstOrdered = getOrdered(first, signMask);
+            const IntegerVector secondOrdered = getOrdered(second, signMask);
+            const IntegerVector difference = _mm512_sub_epi64(firstOrdered, secondOrdered);
+            const __mmask8 negative = _mm512_cmpgt_epi64_mask(secondOrdered, firstOrdered);
+            return _mm512_mask_sub_epi64(difference, negative, _mm512_setzero_si512(), difference);
+        }
+
+        static IntegerVector saturateNan(const IntegerVector& distance, const DoubleVector& first, const DoubleVector& second)
+        {
+            return _mm512_mask_mov_epi64(distance, _mm512_cmp_pd_mask(first, second, _CMP_UNORD_Q), _mm512_set1_epi64(-1));
+        }
+
+        static unsigned greaterMask(const IntegerVector& vector, const IntegerVector& threshold)
+        {
+            return static_cast<unsigned>(_mm512_cmpgt_epu64_mask(vector, threshold));
+        }
+
+        static IntegerVector maximum(const IntegerVector& first, const IntegerVector& second)
+        {
+            return _mm512_max_epu64(first, second);
+        }
+
+        static uint64_t reduceMaximum(const IntegerVector& vector)
+        {
+            return _mm512_reduce_max_epu64(vector);
+        }
+
+    private:
+        static IntegerVector getOrdered(const IntegerVector& bits, const IntegerVector& signMask)
+        {
+            const IntegerVector magnitude = _mm512_andnot_si512(signMask, bits);
+            return _mm512_mask_sub_epi64(magnitude, _mm512_test_epi64_mask(bits, signMask), _mm512_setzero_si512(), magnitude);
+        }
+    };
+
+    static size_t getWidth(const FloatVector&)
+    {
+        return 16;
+    }
+
+    static size_t getWidth(const DoubleVector&)
+    {
+        return 8;
+    }
+
+    static FloatVector load(const float* data)
+    {
+        return _mm512_loadu_ps(data);
+    }
+
+    static FloatVector load(const uint16_t* data)
+    {
+        return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)));
+    }
+
+    static DoubleVector load(const double* data)
+    {
+        return _mm512_loadu_pd(data);
+    }
+
+    static IntegerVector loadBits(const float* data)
+    {
+        return _mm512_loadu_si512(data);
+    }
+
+    static IntegerVector loadBits(const uint16_t* data)
+    {
+        return _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)));
+    }
+
+    static IntegerVector loadBits(const double* data)
+    {
+        return _mm512_loadu_si512(data);
+    }
+
+    static FloatVector broadcast(const float value)
+    {
+        return _mm512_set1_ps(value);
+    }
+
+    static DoubleVector broadcast(const double value)
+    {
+        return _mm512_set1_pd(value);
+    }
+
+    static FloatVector absoluteDifference(const FloatVector& first, const FloatVector& second)
+    {
+        return _mm512_abs_ps(_mm512_sub_ps(first, second));
+    }
+
+    static DoubleVector absoluteDifference(const DoubleVector& first, const DoubleVector& second)
+    {
+        return _mm512_abs_pd(_mm512_sub_pd(first, second));
+    }
+
+    static DoubleVector lowerHalf(const FloatVector& vector)
+    {
+        return _mm512_cvtps_pd(_mm512_castps512_ps256(vector));
+    }
+
+    static DoubleVector upperHalf(const FloatVector& vector)
+    {
+        return _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(vector), 1)));
+    }
+
+    static DoubleVector add(const DoubleVector& first, const DoubleVector& second)
+    {
+        return _mm512_add_pd(first, second);
+    }
+
+    static DoubleVector multiply(const DoubleVector& first, const DoubleVector& second)
+    {
+        return _mm512_mul_pd(first, second);
+    }
+
+    static double sum(const DoubleVector& vector)
+    {
+        return _mm512_reduce_add_pd(vector);
+    }
+
+    static unsigned greaterMask(const FloatVector& vector, const FloatVector& threshold)
+    {
+        return static_cast<unsigned>(_mm512_cmp_ps_mask(vector, threshold, _CMP_GT_OQ));
+    }
+
+    static unsigned greaterMask(const DoubleVector& vector, const DoubleVector& threshold)
+    {
+        return static_cast<unsigned>(_mm512_cmp_pd_mask(vector, threshold, _CMP_GT_OQ));
+    }
+
+    static unsigned lessEqualMask(const FloatVector& vector, const FloatVector& threshold)
+    {
+        return static_cast<unsigned>(_mm512_cmp_ps_mask(vector, threshold, _CMP_LE_OQ));
+    }
+
+    static unsigned lessEqualMask(const DoubleVector& vector, const DoubleVector& threshold)
+    {
+        return static_cast<unsigned>(_mm512_cmp_pd_mask(vector, threshold, _CMP_LE_OQ));
+    }
+
+    // Maximum ignores NaN differences, they are reflected in distances in units in the last place
+    static FloatVector maximum(const FloatVector& accumulator, const FloatVector& vector)
+    {
+        return _mm512_max_ps(vector, accumulator);
+    }
+
+    static DoubleVector maximum(const DoubleVector& accumulator, const DoubleVector& vector)
+    {
+        return _mm512_max_pd(vector, accumulator);
+    }
+
+    static double reduceMaximum(const FloatVector& vector)
+    {
+        return _mm512_reduce_max_ps(vector);
+    }
+
+    static double reduceMaximum(const DoubleVector& vector)
+    {
+        return _mm512_reduce_max_pd(vector);
+    }
+
+    static unsigned relativeMask(const DoubleVector& difference, const DoubleVector& reference, const DoubleVector& floor,
+        const DoubleVector& threshold)
+    {
+        const __mmask8 aboveFloor = _mm512_cmp_pd_mask(difference, floor, _CMP_GT_OQ);
+        const __mmask8 aboveThreshold = _mm512_cmp_pd_mask(_mm512_div_pd(difference, _mm512_abs_pd(reference)), threshold, _CMP_GT_OQ);
+        return static_cast<unsigned>(aboveFloor & aboveThreshold);
+    }
+};
+
+} // namespace
+
+ComparisonKernelSet getAvx512ComparisonKernels()
+{
+    return getSimdComparisonKernels<Avx512>();
+}
+
+} // namespace ktt
@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <tuning_runner/comparison/comparison_kernels.h>
+#include <half.hpp>
+
+namespace ktt
+{
+
+// Half precision elements are compared in single precision
+inline float loadElement(const float* data, const size_t index)
+{
+    return data[index];
+}
+
+inline double loadElement(const double* data, const size_t index)
+{
+    return data[index];
+}
+
+inline float loadElement(const uint16_t* data, const size_t index)
+{
+    return half_float::detail::half2float<float>(data[index]);
+}
+
+inline uint32_t loadBits(const float* data, const size_t index)
+{
+    uint32_t bits;
+    std::memcpy(&bits, data + index, sizeof(bits));
+    return bits;
+}
+
+inline uint64_t loadBits(const double* data, const size_t index)
+{
+    uint64_t bits;
+    std::memcpy(&bits, data + index, sizeof(bits));
+    return bits;
+}
+
+inline uint16_t loadBits(const uint16_t* data, const size_t index)
+{
+    return data[index];
+}
+
+// Distances of half precision elements are saturated to the same value as distances of single precision elements. Distances of other
+// elements are always smaller, so thresholds are clamped below the saturated value and NaN elements always exceed them.
+template <typename T>
+uint64_t getMaximumUlpDistance()
+{
+    return sizeof(T) == sizeof(double) ? std::numeric_limits<uint64_t>::max() : std::numeric_limits<uint32_t>::max();
+}
+
+template <typename T>
+uint64_t getUlpThreshold(const uint64_t threshold)
+{
+    return std::min(threshold, getMaximumUlpDistance<T>() - 1);
+}
+
+// Sign-magnitude representations are mapped to integers ordered in the same way as floating-point values, the distance is difference of the
+// integers, which is smaller than two to the power of bit width, so unsigned arithmetic always produces the exact result
+template <typename T>
+uint64_t getUlpDistance(const T* result, const T* reference, const size_t index)
+{
+    if (std::isnan(loadElement(result, index)) || std::isnan(loadElement(reference, index)))
+    {
+        return getMaximumUlpDistance<T>();
+    }
+
+    using Bits = decltype(loadBits(result, index));
+    const Bits signMask = static_cast<Bits>(Bits(1) << (sizeof(Bits) * 8 - 1));
+    const Bits resultBits = loadBits(result, index);
+    const Bits referenceBits = loadBits(reference, index);
+    const int64_t resultMagnitude = static_cast<int64_t>(resultBits & static_cast<Bits>(~signMask));
+    const int64_t referenceMagnitude = static_cast<int64_t>(referenceBits & static_cast<Bits>(~signMask));
+    const int64_t orderedResult = (resultBits & signMask) != 0 ? -resultMagnitude : resultMagnitude;
+    const int64_t orderedReference = (referenceBits & signMask) != 0 ? -referenceMagnitude : referenceMagnitude;
+
+    if (orderedResult > orderedReference)
+    {
+        return static_cast<uint64_t>(orderedResult) - static_cast<uint64_t>(orderedReference);
+    }
+
+    return static_cast<uint64_t>(orderedReference) - static_cast<uint64_t>(orderedResult);
+}
+
+template <typename T>
+double sumAbsoluteDifferencesScalar(const T* result, const T* reference, const size_t count)
+{
+    double difference = 0.0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        difference += std::fabs(loadElement(result, i) - loadElement(reference, i));
+    }
+
+    return difference;
+}
+
+template <typename T>
+size_t findAbsoluteMismatchScalar(const T* result, const T* reference, const size_t count, const double threshold)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (std::fabs(loadElement(result, i) - loadElement(reference, i)) > threshold)
+        {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+template <typename T>
+size_t findRelativeMismatchScalar(const T* result, const T* reference, const size_t count, const double threshold, const double floor)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const double difference = std::fabs(loadElement(result, i) - loadElement(reference, i));
+
+        if (difference > floor && difference / std::fabs(loadElement(reference, i)) > threshold)
+        {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+template <typename T>
+size_t findUlpMismatchScalar(const T* result, const T* reference, const size_t count, const uint64_t threshold)
+{
+    const uint64_t limit = getUlpThreshold<T>(threshold);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (getUlpDistance(result, reference, i) > limit)
+        {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+template <typename T>
+void accumulateStatisticsScalar(const T* result, const T* reference, const size_t count, const double tolerance, const uint64_t ulpTolerance,
+    ComparisonStatistics& statistics)
+{
+    const uint64_t ulpLimit = getUlpThreshold<T>(ulpTolerance);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const double difference = std::fabs(loadElement(result, i) - loadElement(reference, i));
+        const uint64_t ulpDistance = getUlpDistance(result, reference, i);
+
+        statistics.maximumUlpDistance = std::max(statistics.maximumUlpDistance, ulpDistance);
+        statistics.maximumDifference = std::max(statistics.maximumDifference, difference);
+        statistics.squaredDifferenceSum += difference * difference;
+
+        if (difference <= tolerance || ulpDistance <= ulpLimit)
+        {
+            ++statistics.withinToleranceCount;
+        }
+    }
+}
+
+template <typename T>
+ComparisonKernels<T> getScalarKernels()
+{
+    ComparisonKernels<T> kernels;
+    kernels.sumAbsoluteDifferences = &sumAbsoluteDifferencesScalar<T>;
+    kernels.findAbsoluteMismatch = &findAbsoluteMismatchScalar<T>;
+    kernels.findRelativeMismatch = &findRelativeMismatchScalar<T>;
+    kernels.findUlpMismatch = &findUlpMismatchScalar<T>;
+    kernels.accumulateStatistics = &accumulateStatisticsScalar<T>;
+    return kernels;
+}
+
+ComparisonKernelSet getScalarComparisonKernels()
+{
+    ComparisonKernelSet kernelSet;
+    kernelSet.floatKernels = getScalarKernels<float>();
+    kernelSet.doubleKernels = getScalarKernels<double>();
+    kernelSet.halfKernels = getScalarKernels<uint16_t>();
+    return kernelSet;
+}
+
+} // namespace ktt
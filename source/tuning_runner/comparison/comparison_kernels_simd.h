@@ -0,0 +1,381 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuning_runner/comparison/comparison_kernels.h>
+
+namespace ktt
+{
+
+// Kernels are instantiated in translation units compiled for different instruction sets, internal linkage ensures that the linker never
+// picks an instantiation compiled for a wider instruction set for code which also runs on processors without it. Instruction set traits
+// provide vector types and operations, elements which do not fill the whole vector are compared using zero-padded copies.
+namespace
+{
+
+const size_t maximumVectorWidth = 16;
+
+// Largest single precision value which is not greater than threshold, comparing single precision differences with it gives the same result
+// as comparing them with the threshold in double precision
+inline float getFloatThreshold(const double threshold)
+{
+    float result = static_cast<float>(threshold);
+
+    if (static_cast<double>(result) > threshold)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &result, sizeof(bits));
+        --bits;
+        std::memcpy(&result, &bits, sizeof(result));
+    }
+
+    return result;
+}
+
+inline size_t countSetBits(unsigned mask)
+{
+    size_t count = 0;
+
+    while (mask != 0)
+    {
+        mask &= mask - 1;
+        ++count;
+    }
+
+    return count;
+}
+
+inline size_t getFirstSetBit(const unsigned mask)
+{
+    size_t index = 0;
+
+    while ((mask & (1u << index)) == 0)
+    {
+        ++index;
+    }
+
+    return index;
+}
+
+template <typename Isa>
+typename Isa::FloatVector getThreshold(const typename Isa::FloatVector&, const double threshold)
+{
+    return Isa::broadcast(getFloatThreshold(threshold));
+}
+
+template <typename Isa>
+typename Isa::DoubleVector getThreshold(const typename Isa::DoubleVector&, const double threshold)
+{
+    return Isa::broadcast(threshold);
+}
+
+// Single precision differences are accumulated in double precision
+template <typename Isa>
+void accumulate(typename Isa::DoubleVector& sum, const typename Isa::FloatVector& difference)
+{
+    sum = Isa::add(sum, Isa::add(Isa::lowerHalf(difference), Isa::upperHalf(difference)));
+}
+
+template <typename Isa>
+void accumulate(typename Isa::DoubleVector& sum, const typename Isa::DoubleVector& difference)
+{
+    sum = Isa::add(sum, difference);
+}
+
+template <typename Isa>
+void accumulateSquares(typename Isa::DoubleVector& sum, const typename Isa::FloatVector& difference)
+{
+    const typename Isa::DoubleVector lower = Isa::lowerHalf(difference);
+    const typename Isa::DoubleVector upper = Isa::upperHalf(difference);
+    sum = Isa::add(sum, Isa::add(Isa::multiply(lower, lower), Isa::multiply(upper, upper)));
+}
+
+template <typename Isa>
+void accumulateSquares(typename Isa::DoubleVector& sum, const typename Isa::DoubleVector& difference)
+{
+    sum = Isa::add(sum, Isa::multiply(difference, difference));
+}
+
+// Distances in units in the last place are computed in integer lanes with the same width as lanes of vectors in which the elements are
+// compared, half precision elements are widened to single precision lanes
+template <typename Isa, typename T>
+struct UlpPolicy
+{
+    using Lanes = typename Isa::Lanes32;
+    static const uint64_t signMask = 0x80000000ULL;
+};
+
+template <typename Isa>
+struct UlpPolicy<Isa, uint16_t>
+{
+    using Lanes = typename Isa::Lanes32;
+    static const uint64_t signMask = 0x8000ULL;
+};
+
+template <typename Isa>
+struct UlpPolicy<Isa, double>
+{
+    using Lanes = typename Isa::Lanes64;
+    static const uint64_t signMask = 0x8000000000000000ULL;
+};
+
+template <typename Isa, typename T>
+typename Isa::IntegerVector getUlpDistance(const T* result, const T* reference)
+{
+    using Lanes = typename UlpPolicy<Isa, T>::Lanes;
+    const typename Isa::IntegerVector signMask = Lanes::broadcast(UlpPolicy<Isa, T>::signMask);
+    const typename Isa::IntegerVector distance = Lanes::getDistance(Isa::loadBits(result), Isa::loadBits(reference), signMask);
+    return Lanes::saturateNan(distance, Isa::load(result), Isa::load(reference));
+}
+
+// Saturated distance is reserved for NaN elements, so that they exceed any threshold
+template <typename Isa, typename T>
+typename Isa::IntegerVector getUlpThreshold(const uint64_t threshold)
+{
+    using Lanes = typename UlpPolicy<Isa, T>::Lanes;
+    const uint64_t maximumValue = Lanes::maximumValue - 1;
+    return Lanes::broadcast(threshold < maximumValue ? threshold : maximumValue);
+}
+
+// Relative differences are always computed in double precision, against absolute value of reference elements
+template <typename Isa>
+unsigned getRelativeMask(const typename Isa::FloatVector& difference, const typename Isa::FloatVector& reference,
+    const typename Isa::DoubleVector& floor, const typename Isa::DoubleVector& threshold)
+{
+    const unsigned lowerMask = Isa::relativeMask(Isa::lowerHalf(difference), Isa::lowerHalf(reference), floor, threshold);
+    const unsigned upperMask = Isa::relativeMask(Isa::upperHalf(difference), Isa::upperHalf(reference), floor, threshold);
+    return lowerMask | (upperMask << Isa::getWidth(typename Isa::DoubleVector()));
+}
+
+template <typename Isa>
+unsigned getRelativeMask(const typename Isa::DoubleVector& difference, const typename Isa::DoubleVector& reference,
+    const typename Isa::DoubleVector& floor, const typename Isa::DoubleVector& threshold)
+{
+    return Isa::relativeMask(difference, reference, floor, threshold);
+}
+
+template <typename Isa, typename T>
+double sumAbsoluteDifferencesSimd(const T* result, const T* reference, const size_t count)
+{
+    using Vector = decltype(Isa::load(result));
+    const size_t width = Isa::getWidth(Vector());
+    typename Isa::DoubleVector sum = Isa::broadcast(0.0);
+    size_t i = 0;
+
+    for (; i + width <= count; i += width)
+    {
+        accumulate<Isa>(sum, Isa::absoluteDifference(Isa::load(result + i), Isa::load(reference + i)));
+    }
+
+    if (i < count)
+    {
+        T resultTail[maximumVectorWidth] = {};
+        T referenceTail[maximumVectorWidth] = {};
+        std::memcpy(resultTail, result + i, (count - i) * sizeof(T));
+        std::memcpy(referenceTail, reference + i, (count - i) * sizeof(T));
+        accumulate<Isa>(sum, Isa::absoluteDifference(Isa::load(resultTail), Isa::load(referenceTail)));
+    }
+
+    return Isa::sum(sum);
+}
+
+template <typename Isa, typename T>
+size_t findAbsoluteMismatchSimd(const T* result, const T* reference, const size_t count, const double threshold)
+{
+    using Vector = decltype(Isa::load(result));
+    const size_t width = Isa::getWidth(Vector());
+    const Vector limit = getThreshold<Isa>(Vector(), threshold);
+    size_t i = 0;
+
+    for (; i + width <= count; i += width)
+    {
+        const unsigned mask = Isa::greaterMask(Isa::absoluteDifference(Isa::load(result + i), Isa::load(reference + i)), limit);
+
+        if (mask != 0)
+        {
+            return i + getFirstSetBit(mask);
+        }
+    }
+
+    if (i < count)
+    {
+        T resultTail[maximumVectorWidth] = {};
+        T referenceTail[maximumVectorWidth] = {};
+        std::memcpy(resultTail, result + i, (count - i) * sizeof(T));
+        std::memcpy(referenceTail, reference + i, (count - i) * sizeof(T));
+        const unsigned mask = Isa::greaterMask(Isa::absoluteDifference(Isa::load(resultTail), Isa::load(referenceTail)), limit);
+
+        if (mask != 0)
+        {
+            return i + getFirstSetBit(mask);
+        }
+    }
+
+    return count;
+}
+
+template <typename Isa, typename T>
+size_t findRelativeMismatchSimd(const T* result, const T* reference, const size_t count, const double threshold, const double floor)
+{
+    using Vector = decltype(Isa::load(result));
+    const size_t width = Isa::getWidth(Vector());
+    const typename Isa::DoubleVector floorVector = Isa::broadcast(floor);
+    const typename Isa::DoubleVector limit = Isa::broadcast(threshold);
+    size_t i = 0;
+
+    for (; i + width <= count; i += width)
+    {
+        const Vector referenceVector = Isa::load(reference + i);
+        const Vector difference = Isa::absoluteDifference(Isa::load(result + i), referenceVector);
+        const unsigned mask = getRelativeMask<Isa>(difference, referenceVector, floorVector, limit);
+
+        if (mask != 0)
+        {
+            return i + getFirstSetBit(mask);
+        }
+    }
+
+    if (i < count)
+    {
+        T resultTail[maximumVectorWidth] = {};
+        T referenceTail[maximumVectorWidth] = {};
+        std::memcpy(resultTail, result + i, (count - i) * sizeof(T));
+        std::memcpy(referenceTail, reference + i, (count - i) * sizeof(T));
+        const Vector referenceVector = Isa::load(referenceTail);
+        const Vector difference = Isa::absoluteDifference(Isa::load(resultTail), referenceVector);
+        const unsigned mask = getRelativeMask<Isa>(difference, referenceVector, floorVector, limit);
+
+        if (mask != 0)
+        {
+            return i + getFirstSetBit(mask);
+        }
+    }
+
+    return count;
+}
+
+template <typename Isa, typename T>
+size_t findUlpMismatchSimd(const T* result, const T* reference, const size_t count, const uint64_t threshold)
+{
+    using Vector = decltype(Isa::load(result));
+    using Lanes = typename UlpPolicy<Isa, T>::Lanes;
+    const size_t width = Isa::getWidth(Vector());
+    const typename Isa::IntegerVector limit = getUlpThreshold<Isa, T>(threshold);
+    size_t i = 0;
+
+    for (; i + width <= count; i += width)
+    {
+        const unsigned mask = Lanes::greaterMask(getUlpDistance<Isa>(result + i, reference + i), limit);
+
+        if (mask != 0)
+        {
+            return i + getFirstSetBit(mask);
+        }
+    }
+
+    if (i < count)
+    {
+        T resultTail[maximumVectorWidth] = {};
+        T referenceTail[maximumVectorWidth] = {};
+        std::memcpy(resultTail, result + i, (count - i) * sizeof(T));
+        std::memcpy(referenceTail, reference + i, (count - i) * sizeof(T));
+        const unsigned mask = Lanes::greaterMask(getUlpDistance<Isa>(resultTail, referenceTail), limit);
+
+        if (mask != 0)
+        {
+            return i + getFirstSetBit(mask);
+        }
+    }
+
+    return count;
+}
+
+template <typename Isa, typename T>
+void accumulateStatisticsSimd(const T* result, const T* reference, const size_t count, const double tolerance, const uint64_t ulpTolerance,
+    ComparisonStatistics& statistics)
+{
+    using Vector = decltype(Isa::load(result));
+    using Lanes = typename UlpPolicy<Isa, T>::Lanes;
+    const size_t width = Isa::getWidth(Vector());
+    const Vector limit = getThreshold<Isa>(Vector(), tolerance);
+    const typename Isa::IntegerVector ulpLimit = getUlpThreshold<Isa, T>(ulpTolerance);
+
+    typename Isa::IntegerVector maximumUlpDistance = Lanes::broadcast(0);
+    Vector maximumDifference = getThreshold<Isa>(Vector(), 0.0);
+    typename Isa::DoubleVector squaredDifferenceSum = Isa::broadcast(0.0);
+    size_t withinToleranceCount = 0;
+
+    auto accumulateVector = [&](const T* resultData, const T* referenceData, const unsigned laneMask)
+    {
+        const Vector difference = Isa::absoluteDifference(Isa::load(resultData), Isa::load(referenceData));
+        const typename Isa::IntegerVector ulpDistance = getUlpDistance<Isa>(resultData, referenceData);
+
+        maximumUlpDistance = Lanes::maximum(maximumUlpDistance, ulpDistance);
+        maximumDifference = Isa::maximum(maximumDifference, difference);
+        accumulateSquares<Isa>(squaredDifferenceSum, difference);
+
+        const unsigned withinMask = Isa::lessEqualMask(difference, limit) | ~Lanes::greaterMask(ulpDistance, ulpLimit);
+        withinToleranceCount += countSetBits(withinMask & laneMask);
+    };
+
+    const unsigned fullMask = (1u << width) - 1;
+    size_t i = 0;
+
+    for (; i + width <= count; i += width)
+    {
+        accumulateVector(result + i, reference + i, fullMask);
+    }
+
+    // Padding elements are equal, so they only need to be excluded from the number of elements within tolerance
+    if (i < count)
+    {
+        T resultTail[maximumVectorWidth] = {};
+        T referenceTail[maximumVectorWidth] = {};
+        std::memcpy(resultTail, result + i, (count - i) * sizeof(T));
+        std::memcpy(referenceTail, reference + i, (count - i) * sizeof(T));
+        accumulateVector(resultTail, referenceTail, (1u << (count - i)) - 1);
+    }
+
+    const uint64_t blockUlpDistance = Lanes::reduceMaximum(maximumUlpDistance);
+    const double blockDifference = Isa::reduceMaximum(maximumDifference);
+
+    if (blockUlpDistance > statistics.maximumUlpDistance)
+    {
+        statistics.maximumUlpDistance = blockUlpDistance;
+    }
+
+    if (blockDifference > statistics.maximumDifference)
+    {
+        statistics.maximumDifference = blockDifference;
+    }
+
+    statistics.squaredDifferenceSum += Isa::sum(squaredDifferenceSum);
+    statistics.withinToleranceCount += withinToleranceCount;
+}
+
+template <typename Isa, typename T>
+ComparisonKernels<T> getSimdKernels()
+{
+    ComparisonKernels<T> kernels;
+    kernels.sumAbsoluteDifferences = &sumAbsoluteDifferencesSimd<Isa, T>;
+    kernels.findAbsoluteMismatch = &findAbsoluteMismatchSimd<Isa, T>;
+    kernels.findRelativeMismatch = &findRelativeMismatchSimd<Isa, T>;
+    kernels.findUlpMismatch = &findUlpMismatchSimd<Isa, T>;
+    kernels.accumulateStatistics = &accumulateStatisticsSimd<Isa, T>;
+    return kernels;
+}
+
+template <typename Isa>
+ComparisonKernelSet getSimdComparisonKernels()
+{
+    ComparisonKernelSet kernelSet;
+    kernelSet.floatKernels = getSimdKernels<Isa, float>();
+    kernelSet.doubleKernels = getSimdKernels<Isa, double>();
+    kernelSet.halfKernels = getSimdKernels<Isa, uint16_t>();
+    return kernelSet;
+}
+
+} // namespace
+
+} // namespace ktt
@@ -0,0 +1,309 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+#include <tuning_runner/comparison/result_comparator.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace ktt
+{
+
+// Number of elements compared between checks whether another thread already found elements which exceed tolerance
+const size_t comparisonBlockSize = 16384;
+
+// Arguments are only split between threads if each thread compares at least this number of elements
+const size_t minimumChunkSize = 1048576;
+
+// Tolerance thresholds of comparisons in units in the last place are clamped to the largest distance
+const double maximumUlpTolerance = 1.8e19;
+
+ResultComparator::ResultComparator() :
+    kernels(selectKernels()),
+    relativeComparisonFloor(1e-4),
+    threadPool(ThreadPool::getHardwareThreadCount())
+{}
+
+ComparisonOutcome ResultComparator::compare(const float* result, const float* reference, const size_t count, const ValidationMethod method,
+    const double tolerance) const
+{
+    return compareWithKernels(result, reference, count, method, tolerance, kernels.floatKernels);
+}
+
+ComparisonOutcome ResultComparator::compare(const double* result, const double* reference, const size_t count, const ValidationMethod method,
+    const double tolerance) const
+{
+    return compareWithKernels(result, reference, count, method, tolerance, kernels.doubleKernels);
+}
+
+ComparisonOutcome ResultComparator::compare(const half* result, const half* reference, const size_t count, const ValidationMethod method,
+    const double tolerance) const
+{
+    static_assert(sizeof(half) == sizeof(uint16_t), "Half precision elements are compared as their binary representation");
+    return compareWithKernels(reinterpret_cast<const uint16_t*>(result), reinterpret_cast<const uint16_t*>(reference), count, method,
+        tolerance, kernels.halfKernels);
+}
+
+size_t ResultComparator::findDifference(const void* result, const void* reference, const size_t count, const size_t elementSizeInBytes) const
+{
+    const uint8_t* resultBytes = static_cast<const uint8_t*>(result);
+    const uint8_t* referenceBytes = static_cast<const uint8_t*>(reference);
+    std::atomic<bool> differenceFound(false);
+
+    const std::vector<size_t> indices = processChunks(count, [&](const size_t begin, const size_t end)
+    {
+        for (size_t blockBegin = begin; blockBegin < end && !differenceFound.load(std::memory_order_relaxed); blockBegin += comparisonBlockSize)
+        {
+            const size_t blockEnd = std::min(end, blockBegin + comparisonBlockSize);
+            const size_t offset = blockBegin * elementSizeInBytes;
+
+            if (std::memcmp(resultBytes + offset, referenceBytes + offset, (blockEnd - blockBegin) * elementSizeInBytes) == 0)
+            {
+                continue;
+            }
+
+            differenceFound = true;
+            size_t index = blockBegin;
+
+            while (std::memcmp(resultBytes + index * elementSizeInBytes, referenceBytes + index * elementSizeInBytes, elementSizeInBytes) == 0)
+            {
+                ++index;
+            }
+
+            return index;
+        }
+
+        return count;
+    });
+
+    return *std::min_element(indices.cbegin(), indices.cend());
+}
+
+void ResultComparator::setRelativeComparisonFloor(const double floor)
+{
+    relativeComparisonFloor = floor;
+}
+
+template <typename T>
+ComparisonOutcome ResultComparator::compareWithKernels(const T* result, const T* reference, const size_t count, const ValidationMethod method,
+    const double tolerance, const ComparisonKernels<T>& comparisonKernels) const
+{
+    const double floor = relativeComparisonFloor;
+    uint64_t ulpTolerance = 0;
+    ComparisonOutcome outcome{true, count, 0.0, ComparisonStatistics{0, 0.0, 0.0, 0}};
+
+    switch (method)
+    {
+    case ValidationMethod::AbsoluteDifference:
+        outcome.difference = sumDifferences(result, reference, count, tolerance, comparisonKernels.sumAbsoluteDifferences);
+        outcome.passed = !(outcome.difference > tolerance);
+        break;
+    case ValidationMethod::SideBySideComparison:
+        outcome.index = findMismatch(result, reference, count, [&](const T* resultBlock, const T* referenceBlock, const size_t blockCount)
+        {
+            return comparisonKernels.findAbsoluteMismatch(resultBlock, referenceBlock, blockCount, tolerance);
+        });
+        outcome.passed = outcome.index == count;
+        break;
+    case ValidationMethod::SideBySideRelativeComparison:
+        outcome.index = findMismatch(result, reference, count, [&](const T* resultBlock, const T* referenceBlock, const size_t blockCount)
+        {
+            return comparisonKernels.findRelativeMismatch(resultBlock, referenceBlock, blockCount, tolerance, floor);
+        });
+        outcome.passed = outcome.index == count;
+        break;
+    case ValidationMethod::SideBySideUlpComparison:
+        // Fractional part of tolerance is truncated, tuner API only accepts integral tolerances for this method
+        ulpTolerance = tolerance < maximumUlpTolerance ? static_cast<uint64_t>(tolerance) : UINT64_MAX;
+        outcome.index = findMismatch(result, reference, count, [&](const T* resultBlock, const T* referenceBlock, const size_t blockCount)
+        {
+            return comparisonKernels.findUlpMismatch(resultBlock, referenceBlock, blockCount, ulpTolerance);
+        });
+        outcome.passed = outcome.index == count;
+        break;
+    case ValidationMethod::RootMeanSquareError:
+    {
+        outcome.statistics = computeStatistics(result, reference, count, tolerance, 0, comparisonKernels);
+        const double error = count == 0 ? 0.0 : std::sqrt(outcome.statistics.squaredDifferenceSum / static_cast<double>(count));
+        outcome.passed = error <= tolerance;
+        return outcome;
+    }
+    default:
+        throw std::runtime_error("Unsupported validation method");
+    }
+
+    // Statistics require a full pass over the data, so they are only computed to describe failed comparisons
+    if (!outcome.passed)
+    {
+        if (method == ValidationMethod::SideBySideUlpComparison)
+        {
+            outcome.statistics = computeStatistics(result, reference, count, -1.0, ulpTolerance, comparisonKernels);
+        }
+        else
+        {
+            outcome.statistics = computeStatistics(result, reference, count, tolerance, 0, comparisonKernels);
+        }
+    }
+
+    return outcome;
+}
+
+template <typename T, typename Kernel>
+size_t ResultComparator::findMismatch(const T* result, const T* reference, const size_t count, Kernel kernel) const
+{
+    std::atomic<bool> mismatchFound(false);
+
+    const std::vector<size_t> indices = processChunks(count, [&](const size_t begin, const size_t end)
+    {
+        for (size_t blockBegin = begin; blockBegin < end && !mismatchFound.load(std::memory_order_relaxed); blockBegin += comparisonBlockSize)
+        {
+            const size_t blockCount = std::min(comparisonBlockSize, end - blockBegin);
+            const size_t index = kernel(result + blockBegin, reference + blockBegin, blockCount);
+
+            if (index < blockCount)
+            {
+                mismatchFound = true;
+                return blockBegin + index;
+            }
+        }
+
+        return count;
+    });
+
+    return *std::min_element(indices.cbegin(), indices.cend());
+}
+
+template <typename T>
+double ResultComparator::sumDifferences(const T* result, const T* reference, const size_t count, const double threshold,
+    double (*kernel)(const T*, const T*, const size_t)) const
+{
+    std::atomic<bool> thresholdExceeded(false);
+
+    // Differences are never negative, so the summation can stop as soon as partial sum of any chunk exceeds the threshold
+    const std::vector<double> sums = processChunks(count, [&](const size_t begin, const size_t end)
+    {
+        double sum = 0.0;
+
+        for (size_t blockBegin = begin; blockBegin < end && !thresholdExceeded.load(std::memory_order_relaxed); blockBegin += comparisonBlockSize)
+        {
+            const size_t blockCount = std::min(comparisonBlockSize, end - blockBegin);
+            sum += kernel(result + blockBegin, reference + blockBegin, blockCount);
+
+            if (sum > threshold)
+            {
+                thresholdExceeded = true;
+            }
+        }
+
+        return sum;
+    });
+
+    return std::accumulate(sums.cbegin(), sums.cend(), 0.0);
+}
+
+template <typename T>
+ComparisonStatistics ResultComparator::computeStatistics(const T* result, const T* reference, const size_t count, const double tolerance,
+    const uint64_t ulpTolerance, const ComparisonKernels<T>& comparisonKernels) const
+{
+    const std::vector<ComparisonStatistics> chunkStatistics = processChunks(count, [&](const size_t begin, const size_t end)
+    {
+        ComparisonStatistics statistics{0, 0.0, 0.0, 0};
+        comparisonKernels.accumulateStatistics(result + begin, reference + begin, end - begin, tolerance, ulpTolerance, statistics);
+        return statistics;
+    });
+
+    ComparisonStatistics statistics{0, 0.0, 0.0, 0};
+
+    for (const auto& chunk : chunkStatistics)
+    {
+        statistics.maximumUlpDistance = std::max(statistics.maximumUlpDistance, chunk.maximumUlpDistance);
+        statistics.maximumDifference = std::max(statistics.maximumDifference, chunk.maximumDifference);
+        statistics.squaredDifferenceSum += chunk.squaredDifferenceSum;
+        statistics.withinToleranceCount += chunk.withinToleranceCount;
+    }
+
+    return statistics;
+}
+
+template <typename Function>
+auto ResultComparator::processChunks(const size_t count, Function function) const -> std::vector<decltype(function(size_t(), size_t()))>
+{
+    using ResultType = decltype(function(size_t(), size_t()));
+    const size_t chunkCount = std::min(threadPool.getThreadCount(), count / minimumChunkSize);
+
+    if (chunkCount <= 1)
+    {
+        return std::vector<ResultType>{function(0, count)};
+    }
+
+    const size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+    std::vector<std::future<ResultType>> futures;
+
+    for (size_t begin = 0; begin < count; begin += chunkSize)
+    {
+        const size_t end = std::min(count, begin + chunkSize);
+        futures.push_back(threadPool.enqueue([function, begin, end]() { return function(begin, end); }));
+    }
+
+    std::vector<ResultType> results;
+
+    for (auto& future : futures)
+    {
+        results.push_back(future.get());
+    }
+
+    return results;
+}
+
+ComparisonKernelSet ResultComparator::selectKernels()
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+
+    if (info[0] >= 7)
+    {
+        __cpuid(info, 1);
+        const bool f16c = (info[2] & (1 << 29)) != 0;
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const unsigned long long enabledStates = osxsave ? _xgetbv(0) : 0;
+
+        __cpuidex(info, 7, 0);
+        const bool avx2 = (info[1] & (1 << 5)) != 0;
+        const bool avx512 = (info[1] & (1 << 16)) != 0;
+
+        // Operating system has to preserve vector registers, AVX-512 additionally requires mask and upper vector register states
+        if (avx512 && (enabledStates & 0xe6) == 0xe6)
+        {
+            return getAvx512ComparisonKernels();
+        }
+
+        if (avx2 && f16c && (enabledStates & 0x06) == 0x06)
+        {
+            return getAvx2ComparisonKernels();
+        }
+    }
+#elif defined(__GNUC__)
+    __builtin_cpu_init();
+
+    // Feature checks include operating system support, F16C is present on all processors which support AVX2
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return getAvx512ComparisonKernels();
+    }
+
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return getAvx2ComparisonKernels();
+    }
+#endif
+
+    return getScalarComparisonKernels();
+}
+
+} // namespace ktt
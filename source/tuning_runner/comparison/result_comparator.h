@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <enum/validation_method.h>
+#include <tuning_runner/comparison/comparison_kernels.h>
+#include <utility/thread_pool.h>
+#include <half.hpp>
+
+namespace ktt
+{
+
+using half_float::half;
+
+struct ComparisonOutcome
+{
+    bool passed;
+    // Index of element which exceeds tolerance in side-by-side comparisons, number of elements otherwise
+    size_t index;
+    // Sum of absolute differences, it only covers part of the elements if the comparison was terminated early
+    double difference;
+    // Summary of differences of all elements, it is only computed if the comparison fails or if the validation method is based on it
+    ComparisonStatistics statistics;
+};
+
+// Compares result elements with reference elements using the widest vector instruction set supported by the processor. Large arguments are
+// split into chunks which are compared on multiple threads, chunks are processed in blocks, so that all threads stop shortly after one of
+// them finds elements which exceed tolerance.
+class ResultComparator
+{
+public:
+    ResultComparator();
+
+    ComparisonOutcome compare(const float* result, const float* reference, const size_t count, const ValidationMethod method,
+        const double tolerance) const;
+    ComparisonOutcome compare(const double* result, const double* reference, const size_t count, const ValidationMethod method,
+        const double tolerance) const;
+    ComparisonOutcome compare(const half* result, const half* reference, const size_t count, const ValidationMethod method,
+        const double tolerance) const;
+
+    // Returns index of element which differs or number of elements if the data are equal
+    size_t findDifference(const void* result, const void* reference, const size_t count, const size_t elementSizeInBytes) const;
+
+    void setRelativeComparisonFloor(const double floor);
+
+private:
+    ComparisonKernelSet kernels;
+    double relativeComparisonFloor;
+    mutable ThreadPool threadPool;
+
+    template <typename T>
+    ComparisonOutcome compareWithKernels(const T* result, const T* reference, const size_t count, const ValidationMethod method,
+        const double tolerance, const ComparisonKernels<T>& comparisonKernels) const;
+    template <typename T, typename Kernel>
+    size_t findMismatch(const T* result, const T* reference, const size_t count, Kernel kernel) const;
+    template <typename T>
+    double sumDifferences(const T* result, const T* reference, const size_t count, const double threshold,
+        double (*kernel)(const T*, const T*, const size_t)) const;
+    template <typename T>
+    ComparisonStatistics computeStatistics(const T* result, const T* reference, const size_t count, const double tolerance,
+        const uint64_t ulpTolerance, const ComparisonKernels<T>& comparisonKernels) const;
+    template <typename Function>
+    auto processChunks(const size_t count, Function function) const -> std::vector<decltype(function(size_t(), size_t()))>;
+    static ComparisonKernelSet selectKernels();
+};
+
+} // namespace ktt
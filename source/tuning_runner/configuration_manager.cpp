@@ -5,6 +5,7 @@
 #include <tuning_runner/searcher/full_searcher.h>
 #include <tuning_runner/searcher/random_searcher.h>
 #include <tuning_runner/searcher/mcmc_searcher.h>
+#include <tuning_runner/searcher/warm_start_searcher.h>
 #include <tuning_runner/configuration_manager.h>
 #include <utility/ktt_utility.h>
 
@@ -67,6 +68,50 @@ void ConfigurationManager::setSearchMethod(const SearchMethod method, const std:
     this->searchMethod = method;
 }
 
+void ConfigurationManager::setSearcher(const KernelId id, std::unique_ptr<Searcher> searcher)
+{
+    resetSearcher(id);
+    customSearchers.erase(id);
+
+    if (searcher != nullptr)
+    {
+        customSearchers.insert(std::make_pair(id, std::move(searcher)));
+    }
+}
+
+void ConfigurationManager::setWarmStartConfigurations(const KernelId id, const std::vector<std::vector<ParameterPair>>& seedConfigurations)
+{
+    resetSearcher(id);
+    warmStartConfigurations.erase(id);
+
+    if (!seedConfigurations.empty())
+    {
+        warmStartConfigurations.insert(std::make_pair(id, seedConfigurations));
+    }
+}
+
+void ConfigurationManager::addObjective(const KernelId id, const TuningObjective& objective)
+{
+    std::vector<TuningObjective>& kernelObjectives = objectives[id];
+
+    for (const auto& existingObjective : kernelObjectives)
+    {
+        if (existingObjective.getName() == objective.getName())
+        {
+            throw std::runtime_error(std::string("Tuning objective with the following name already exists: ") + objective.getName());
+        }
+    }
+
+    kernelObjectives.push_back(objective);
+    clearBestResults(id);
+}
+
+void ConfigurationManager::clearObjectives(const KernelId id)
+{
+    objectives.erase(id);
+    clearBestResults(id);
+}
+
 bool ConfigurationManager::hasKernelConfigurations(const KernelId id) const
 {
     return kernelConfigurations.find(id) != kernelConfigurations.end() || hasPackConfigurations(id);
@@ -79,10 +124,7 @@ bool ConfigurationManager::hasPackConfigurations(const KernelId id) const
 
 void ConfigurationManager::clearKernelData(const KernelId id, const bool clearConfigurations, const bool clearBestConfiguration)
 {
-    if (searchers.find(id) != searchers.end())
-    {
-        searchers.erase(id);
-    }
+    resetSearcher(id);
 
     if (clearConfigurations && kernelConfigurations.find(id) != kernelConfigurations.end())
     {
@@ -97,9 +139,9 @@ void ConfigurationManager::clearKernelData(const KernelId id, const bool clearCo
         configurationStorages.erase(id);
     }
 
-    if (clearBestConfiguration && bestConfigurations.find(id) != bestConfigurations.end())
+    if (clearBestConfiguration)
     {
-        bestConfigurations.erase(id);
+        clearBestResults(id);
     }
 }
 
@@ -133,8 +175,8 @@ size_t ConfigurationManager::getConfigurationCount(const KernelId id)
 KernelConfiguration ConfigurationManager::getCurrentConfiguration(const Kernel& kernel)
 {
     const size_t id = kernel.getId();
-    auto searcherPair = searchers.find(id);
-    if (searcherPair == searchers.end())
+    Searcher* searcher = findSearcher(id);
+    if (searcher == nullptr)
     {
         if (!hasPackConfigurations(id))
         {
@@ -142,7 +184,7 @@ KernelConfiguration ConfigurationManager::getCurrentConfiguration(const Kernel&
             if (configurationPair != kernelConfigurations.end())
             {
                 initializeSearcher(id, searchMethod, searchArguments, configurationPair->second);
-                searcherPair = searchers.find(id);
+                searcher = findSearcher(id);
             }
             else
             {
@@ -155,7 +197,7 @@ KernelConfiguration ConfigurationManager::getCurrentConfiguration(const Kernel&
             if (configurationPair != packKernelConfigurations.end())
             {
                 initializeSearcher(id, searchMethod, searchArguments, configurationPair->second.second);
-                searcherPair = searchers.find(id);
+                searcher = findSearcher(id);
             }
             else
             {
@@ -164,7 +206,7 @@ KernelConfiguration ConfigurationManager::getCurrentConfiguration(const Kernel&
         }
     }
 
-    if (searcherPair->second->getUnexploredConfigurationCount() <= 0)
+    if (searcher->getUnexploredConfigurationCount() <= 0)
     {
         if (!hasPackConfigurations(id) || !hasNextParameterPack(id))
         {
@@ -178,22 +220,22 @@ KernelConfiguration ConfigurationManager::getCurrentConfiguration(const Kernel&
         }
         else
         {
-            searchers.erase(id);
+            resetSearcher(id);
             configurationStorages.find(id)->second.storeProcessedPack(getCurrentParameterPack(kernel));
             prepareNextPackKernelConfigurations(kernel);
             initializeSearcher(id, searchMethod, searchArguments, packKernelConfigurations.find(id)->second.second);
-            searcherPair = searchers.find(id);
+            searcher = findSearcher(id);
         }
     }
 
-    return searcherPair->second->getNextConfiguration();
+    return getNextSearcherConfiguration(*searcher);
 }
 
 KernelConfiguration ConfigurationManager::getCurrentConfiguration(const KernelComposition& composition)
 {
     const size_t id = composition.getId();
-    auto searcherPair = searchers.find(id);
-    if (searcherPair == searchers.end())
+    Searcher* searcher = findSearcher(id);
+    if (searcher == nullptr)
     {
         if (!hasPackConfigurations(id))
         {
@@ -201,7 +243,7 @@ KernelConfiguration ConfigurationManager::getCurrentConfiguration(const KernelCo
             if (configurationPair != kernelConfigurations.end())
             {
                 initializeSearcher(id, searchMethod, searchArguments, configurationPair->second);
-                searcherPair = searchers.find(id);
+                searcher = findSearcher(id);
             }
             else
             {
@@ -214,7 +256,7 @@ KernelConfiguration ConfigurationManager::getCurrentConfiguration(const KernelCo
             if (configurationPair != packKernelConfigurations.end())
             {
                 initializeSearcher(id, searchMethod, searchArguments, configurationPair->second.second);
-                searcherPair = searchers.find(id);
+                searcher = findSearcher(id);
             }
             else
             {
@@ -223,7 +265,7 @@ KernelConfiguration ConfigurationManager::getCurrentConfiguration(const KernelCo
         }
     }
 
-    if (searcherPair->second->getUnexploredConfigurationCount() <= 0)
+    if (searcher->getUnexploredConfigurationCount() <= 0)
     {
         if (!hasPackConfigurations(id) || !hasNextParameterPack(id))
         {
@@ -237,15 +279,57 @@ KernelConfiguration ConfigurationManager::getCurrentConfiguration(const KernelCo
         }
         else
         {
-            searchers.erase(id);
+            resetSearcher(id);
             configurationStorages.find(id)->second.storeProcessedPack(getCurrentParameterPack(composition));
             prepareNextPackKernelCompositionConfigurations(composition);
             initializeSearcher(id, searchMethod, searchArguments, packKernelConfigurations.find(id)->second.second);
-            searcherPair = searchers.find(id);
+            searcher = findSearcher(id);
+        }
+    }
+
+    return getNextSearcherConfiguration(*searcher);
+}
+
+std::vector<KernelConfiguration> ConfigurationManager::getUpcomingConfigurations(const KernelId id, const size_t count) const
+{
+    std::vector<KernelConfiguration> result;
+    const Searcher* searcher = findSearcher(id);
+
+    if (searcher == nullptr || count == 0)
+    {
+        return result;
+    }
+
+    for (const auto index : searcher->getUpcomingConfigurationIndices(count))
+    {
+        if (index < searcher->getConfigurationCount())
+        {
+            result.push_back(searcher->configurations->at(index));
+        }
+    }
+
+    return result;
+}
+
+std::vector<KernelConfiguration> ConfigurationManager::getLikelyConfigurations(const KernelId id, const size_t count) const
+{
+    std::vector<KernelConfiguration> result;
+    const Searcher* searcher = findSearcher(id);
+
+    if (searcher == nullptr || count == 0)
+    {
+        return result;
+    }
+
+    for (const auto index : searcher->getLikelyConfigurationIndices(count))
+    {
+        if (index < searcher->getConfigurationCount() && result.size() < count)
+        {
+            result.push_back(searcher->configurations->at(index));
         }
     }
 
-    return searcherPair->second->getNextConfiguration();
+    return result;
 }
 
 KernelConfiguration ConfigurationManager::getBestConfiguration(const Kernel& kernel)
@@ -272,81 +356,95 @@ KernelConfiguration ConfigurationManager::getBestConfiguration(const KernelCompo
 
 ComputationResult ConfigurationManager::getBestComputationResult(const KernelId id) const
 {
-    auto configurationPair = bestConfigurations.find(id);
-    if (configurationPair == bestConfigurations.end())
+    auto resultPair = bestComputationResults.find(id);
+    if (resultPair == bestComputationResults.end())
     {
         return ComputationResult("", std::vector<ParameterPair>{}, "Valid result does not exist");
     }
 
-    const KernelResult& result = configurationPair->second;
-
-    if (!result.getCompositionCompilationData().empty())
+    if (resultPair->second.getStatus() && resultPair->second.getObjectiveValue() == std::numeric_limits<double>::max())
     {
-        return ComputationResult(result.getKernelName(), result.getConfiguration().getParameterPairs(), result.getComputationDuration(),
-            result.getCompositionCompilationData(), result.getCompositionProfilingData());
+        return ComputationResult(resultPair->second.getKernelName(), std::vector<ParameterPair>{},
+            "Valid result which satisfies tuning objective limits does not exist");
     }
 
-    return ComputationResult(result.getKernelName(), result.getConfiguration().getParameterPairs(), result.getComputationDuration(),
-        result.getCompilationData(), result.getProfilingData());
+    return resultPair->second;
 }
 
-void ConfigurationManager::calculateNextConfiguration(const Kernel& kernel, const KernelResult& previousResult)
+std::vector<ComputationResult> ConfigurationManager::getParetoFront(const KernelId id) const
 {
-    const size_t id = kernel.getId();
-    auto searcherPair = searchers.find(id);
-    if (searcherPair == searchers.end())
+    auto front = paretoFronts.find(id);
+    if (front == paretoFronts.end())
     {
-        throw std::runtime_error(std::string("Configurations for the following kernel were not initialized yet: ") + kernel.getName());
+        return std::vector<ComputationResult>{};
     }
 
-    auto configurationPair = bestConfigurations.find(id);
-    if (configurationPair == bestConfigurations.end())
-    {
-        bestConfigurations.insert(std::make_pair(id, previousResult));
-    }
-    else if (configurationPair->second.getComputationDuration() > previousResult.getComputationDuration())
-    {
-        bestConfigurations.erase(id);
-        bestConfigurations.insert(std::make_pair(id, previousResult));
-    }
+    return front->second;
+}
 
-    if (hasPackConfigurations(id))
+ComputationResult ConfigurationManager::calculateNextConfiguration(const Kernel& kernel, const KernelResult& previousResult)
+{
+    const size_t id = kernel.getId();
+    Searcher* searcher = findSearcher(id);
+    if (searcher == nullptr)
     {
-        ConfigurationStorage& storage = configurationStorages.find(id)->second;
-        storage.storeConfiguration(std::make_pair(previousResult.getConfiguration(), previousResult.getComputationDuration()));
+        throw std::runtime_error(std::string("Configurations for the following kernel were not initialized yet: ") + kernel.getName());
     }
 
-    searcherPair->second->calculateNextConfiguration(previousResult);
+    const ComputationResult result = processResult(id, previousResult);
+    searcher->calculateNextConfiguration(result);
+    return result;
 }
 
-void ConfigurationManager::calculateNextConfiguration(const KernelComposition& composition, const KernelResult& previousResult)
+ComputationResult ConfigurationManager::calculateNextConfiguration(const KernelComposition& composition, const KernelResult& previousResult)
 {
     const size_t id = composition.getId();
-    auto searcherPair = searchers.find(id);
-    if (searcherPair == searchers.end())
+    Searcher* searcher = findSearcher(id);
+    if (searcher == nullptr)
     {
         throw std::runtime_error(std::string("Configurations for the following kernel composition were not initialized yet: ")
             + composition.getName());
     }
 
-    auto configurationPair = bestConfigurations.find(id);
-    if (configurationPair == bestConfigurations.end())
-    {
-        bestConfigurations.insert(std::make_pair(id, previousResult));
-    }
-    else if (configurationPair->second.getComputationDuration() > previousResult.getComputationDuration())
+    const ComputationResult result = processResult(id, previousResult);
+    searcher->calculateNextConfiguration(result);
+    return result;
+}
+
+ComputationResult ConfigurationManager::evaluateResult(const KernelId id, const KernelResult& result) const
+{
+    return evaluateObjectives(id, getComputationResult(result));
+}
+
+ComputationResult ConfigurationManager::selectBestResult(const KernelId id, const std::vector<KernelResult>& results)
+{
+    if (results.empty())
     {
-        bestConfigurations.erase(id);
-        bestConfigurations.insert(std::make_pair(id, previousResult));
+        return getBestComputationResult(id);
     }
 
-    if (hasPackConfigurations(id))
+    // Previously recorded best result is replaced even if it was better, Pareto front is not affected
+    size_t bestIndex = 0;
+    ComputationResult bestResult = evaluateResult(id, results[0]);
+
+    for (size_t i = 1; i < results.size(); ++i)
     {
-        ConfigurationStorage& storage = configurationStorages.find(id)->second;
-        storage.storeConfiguration(std::make_pair(previousResult.getConfiguration(), previousResult.getComputationDuration()));
+        const ComputationResult currentResult = evaluateResult(id, results[i]);
+        const bool currentEligible = currentResult.getStatus() && !currentResult.isCensored();
+        const bool bestEligible = bestResult.getStatus() && !bestResult.isCensored();
+
+        if (currentEligible && (!bestEligible || currentResult.getObjectiveValue() < bestResult.getObjectiveValue()))
+        {
+            bestIndex = i;
+            bestResult = currentResult;
+        }
     }
 
-    searcherPair->second->calculateNextConfiguration(previousResult);
+    bestConfigurations.erase(id);
+    bestComputationResults.erase(id);
+    bestConfigurations.insert(std::make_pair(id, results[bestIndex]));
+    bestComputationResults.insert(std::make_pair(id, bestResult));
+    return bestResult;
 }
 
 void ConfigurationManager::initializeOrderedKernelPacks(const Kernel& kernel)
@@ -794,23 +892,238 @@ KernelParameterPack ConfigurationManager::getCurrentParameterPack(const KernelCo
 void ConfigurationManager::initializeSearcher(const KernelId id, const SearchMethod method, const std::vector<double>& arguments,
     const std::vector<KernelConfiguration>& configurations)
 {
+    auto customSearcher = customSearchers.find(id);
+    if (customSearcher != customSearchers.end())
+    {
+        customSearcher->second->initialize(configurations);
+        return;
+    }
+
+    std::unique_ptr<Searcher> searcher;
+
+    auto warmStart = warmStartConfigurations.find(id);
+    if (warmStart != warmStartConfigurations.end())
+    {
+        searcher = std::make_unique<WarmStartSearcher>(warmStart->second);
+        searcher->initialize(configurations);
+        searchers.insert(std::make_pair(id, std::move(searcher)));
+        return;
+    }
+
     switch (method)
     {
     case SearchMethod::FullSearch:
-        searchers.insert(std::make_pair(id, std::make_unique<FullSearcher>(configurations)));
+        searcher = std::make_unique<FullSearcher>();
         break;
     case SearchMethod::RandomSearch:
-        searchers.insert(std::make_pair(id, std::make_unique<RandomSearcher>(configurations)));
+        searcher = std::make_unique<RandomSearcher>();
         break;
     case SearchMethod::Annealing:
-        searchers.insert(std::make_pair(id, std::make_unique<AnnealingSearcher>(configurations, arguments.at(0))));
+        searcher = std::make_unique<AnnealingSearcher>(arguments.at(0));
         break;
     case SearchMethod::MCMC:
-        searchers.insert(std::make_pair(id, std::make_unique<MCMCSearcher>(configurations, arguments)));
+        searcher = std::make_unique<MCMCSearcher>(arguments);
         break;
     default:
         throw std::runtime_error("Specified searcher is not supported");
     }
+
+    searcher->initialize(configurations);
+    searchers.insert(std::make_pair(id, std::move(searcher)));
+}
+
+Searcher* ConfigurationManager::findSearcher(const KernelId id) const
+{
+    auto customSearcher = customSearchers.find(id);
+    if (customSearcher != customSearchers.end())
+    {
+        if (customSearcher->second->isInitialized())
+        {
+            return customSearcher->second.get();
+        }
+        return nullptr;
+    }
+
+    auto searcher = searchers.find(id);
+    if (searcher != searchers.end())
+    {
+        return searcher->second.get();
+    }
+
+    return nullptr;
+}
+
+void ConfigurationManager::resetSearcher(const KernelId id)
+{
+    auto customSearcher = customSearchers.find(id);
+    if (customSearcher != customSearchers.end())
+    {
+        customSearcher->second->reset();
+    }
+
+    auto searcher = searchers.find(id);
+    if (searcher != searchers.end())
+    {
+        searcher->second->reset();
+        searchers.erase(id);
+    }
+}
+
+KernelConfiguration ConfigurationManager::getNextSearcherConfiguration(const Searcher& searcher)
+{
+    const size_t index = searcher.getNextConfigurationIndex();
+
+    if (index >= searcher.getConfigurationCount())
+    {
+        throw std::runtime_error(std::string("Searcher returned configuration index which is out of range: ") + std::to_string(index));
+    }
+
+    return searcher.configurations->at(index);
+}
+
+ComputationResult ConfigurationManager::processResult(const KernelId id, const KernelResult& result)
+{
+    const ComputationResult computationResult = evaluateObjectives(id, getComputationResult(result));
+
+    auto resultPair = bestComputationResults.find(id);
+    if (resultPair == bestComputationResults.end()
+        || (!computationResult.isCensored() && resultPair->second.getObjectiveValue() > computationResult.getObjectiveValue()))
+    {
+        bestConfigurations.erase(id);
+        bestComputationResults.erase(id);
+        bestConfigurations.insert(std::make_pair(id, result));
+        bestComputationResults.insert(std::make_pair(id, computationResult));
+    }
+
+    updateParetoFront(id, computationResult);
+
+    if (hasPackConfigurations(id))
+    {
+        ConfigurationStorage& storage = configurationStorages.find(id)->second;
+        storage.storeConfiguration(std::make_pair(result.getConfiguration(), computationResult.getObjectiveValue()));
+    }
+
+    return computationResult;
+}
+
+ComputationResult ConfigurationManager::evaluateObjectives(const KernelId id, const ComputationResult& result) const
+{
+    auto kernelObjectives = objectives.find(id);
+    if (kernelObjectives == objectives.end() || !result.getStatus())
+    {
+        return result;
+    }
+
+    ComputationResult evaluatedResult = result;
+    std::map<std::string, double> objectiveValues;
+    double objectiveValue = 0.0;
+    bool limitsSatisfied = true;
+
+    for (const auto& objective : kernelObjectives->second)
+    {
+        const double value = objective.evaluate(result);
+        objectiveValues.insert(std::make_pair(objective.getName(), value));
+        objectiveValue += objective.getWeight() * value;
+
+        if (value > objective.getLimit())
+        {
+            limitsSatisfied = false;
+        }
+    }
+
+    evaluatedResult.setObjectiveValues(limitsSatisfied ? objectiveValue : std::numeric_limits<double>::max(), objectiveValues);
+    return evaluatedResult;
+}
+
+void ConfigurationManager::updateParetoFront(const KernelId id, const ComputationResult& result)
+{
+    if (!result.getStatus() || result.isCensored() || result.getObjectiveValue() == std::numeric_limits<double>::max())
+    {
+        return;
+    }
+
+    std::vector<ComputationResult>& front = paretoFronts[id];
+
+    for (const auto& frontResult : front)
+    {
+        if (dominates(frontResult, result))
+        {
+            return;
+        }
+    }
+
+    front.erase(std::remove_if(front.begin(), front.end(), [&result](const auto& frontResult)
+    {
+        return dominates(result, frontResult);
+    }), front.end());
+    front.push_back(result);
+}
+
+void ConfigurationManager::clearBestResults(const KernelId id)
+{
+    bestConfigurations.erase(id);
+    bestComputationResults.erase(id);
+    paretoFronts.erase(id);
+}
+
+bool ConfigurationManager::dominates(const ComputationResult& first, const ComputationResult& second)
+{
+    if (first.getObjectiveValues().empty() || second.getObjectiveValues().empty())
+    {
+        return first.getDuration() < second.getDuration();
+    }
+
+    bool strictlyBetter = false;
+
+    for (const auto& value : first.getObjectiveValues())
+    {
+        const double otherValue = second.getObjectiveValues().at(value.first);
+
+        if (value.second > otherValue)
+        {
+            return false;
+        }
+        if (value.second < otherValue)
+        {
+            strictlyBetter = true;
+        }
+    }
+
+    return strictlyBetter;
+}
+
+ComputationResult ConfigurationManager::getComputationResult(const KernelResult& result)
+{
+    if (!result.isValid())
+    {
+        return ComputationResult(result.getKernelName(), result.getConfiguration().getParameterPairs(), result.getErrorMessage());
+    }
+
+    ComputationResult computationResult;
+
+    if (!result.getCompositionCompilationData().empty())
+    {
+        computationResult = ComputationResult(result.getKernelName(), result.getConfiguration().getParameterPairs(),
+            result.getComputationDuration(), result.getCompositionCompilationData(), result.getCompositionProfilingData());
+    }
+    else
+    {
+        computationResult = ComputationResult(result.getKernelName(), result.getConfiguration().getParameterPairs(),
+            result.getComputationDuration(), result.getCompilationData(), result.getProfilingData());
+    }
+
+    computationResult.setCensored(result.isCensored());
+
+    if (result.getMeasurementStatistics().getMeasurementCount() > 0)
+    {
+        computationResult.setMeasurementStatistics(result.getMeasurementStatistics());
+    }
+    else
+    {
+        computationResult.setMeasurementStatistics(MeasurementStatistics(std::vector<uint64_t>{result.getComputationDuration()}));
+    }
+
+    return computationResult;
 }
 
 bool ConfigurationManager::checkParameterPairs(const std::vector<ParameterPair>& pairs, const std::vector<KernelConstraint>& constraints)
@@ -8,6 +8,7 @@
 #include <vector>
 #include <api/computation_result.h>
 #include <api/device_info.h>
+#include <api/searcher/searcher.h>
 #include <dto/kernel_result.h>
 #include <enum/search_method.h>
 #include <kernel/kernel.h>
@@ -15,8 +16,8 @@
 #include <kernel/kernel_configuration.h>
 #include <kernel/kernel_constraint.h>
 #include <kernel/kernel_parameter.h>
-#include <tuning_runner/searcher/searcher.h>
 #include <tuning_runner/configuration_storage.h>
+#include <tuning_runner/tuning_objective.h>
 #include <ktt_types.h>
 
 namespace ktt
@@ -32,6 +33,10 @@ public:
     void initializeConfigurations(const Kernel& kernel);
     void initializeConfigurations(const KernelComposition& composition);
     void setSearchMethod(const SearchMethod method, const std::vector<double>& arguments);
+    void setSearcher(const KernelId id, std::unique_ptr<Searcher> searcher);
+    void setWarmStartConfigurations(const KernelId id, const std::vector<std::vector<ParameterPair>>& seedConfigurations);
+    void addObjective(const KernelId id, const TuningObjective& objective);
+    void clearObjectives(const KernelId id);
     bool hasKernelConfigurations(const KernelId id) const;
     bool hasPackConfigurations(const KernelId id) const;
     void clearKernelData(const KernelId id, const bool clearConfigurations, const bool clearBestConfiguration);
@@ -40,11 +45,17 @@ public:
     size_t getConfigurationCount(const KernelId id);
     KernelConfiguration getCurrentConfiguration(const Kernel& kernel);
     KernelConfiguration getCurrentConfiguration(const KernelComposition& composition);
+    std::vector<KernelConfiguration> getUpcomingConfigurations(const KernelId id, const size_t count) const;
+    std::vector<KernelConfiguration> getLikelyConfigurations(const KernelId id, const size_t count) const;
     KernelConfiguration getBestConfiguration(const Kernel& kernel);
     KernelConfiguration getBestConfiguration(const KernelComposition& composition);
     ComputationResult getBestComputationResult(const KernelId id) const;
-    void calculateNextConfiguration(const Kernel& kernel, const KernelResult& previousResult);
-    void calculateNextConfiguration(const KernelComposition& composition, const KernelResult& previousResult);
+    std::vector<ComputationResult> getParetoFront(const KernelId id) const;
+    ComputationResult calculateNextConfiguration(const Kernel& kernel, const KernelResult& previousResult);
+    ComputationResult calculateNextConfiguration(const KernelComposition& composition, const KernelResult& previousResult);
+    ComputationResult evaluateResult(const KernelId id, const KernelResult& result) const;
+    ComputationResult selectBestResult(const KernelId id, const std::vector<KernelResult>& results);
+    static ComputationResult getComputationResult(const KernelResult& result);
 
 private:
     // Attributes
@@ -53,7 +64,12 @@ private:
     std::map<KernelId, std::vector<std::pair<size_t, std::string>>> orderedKernelPacks;
     mutable std::map<KernelId, size_t> currentPackIndices;
     std::map<KernelId, std::unique_ptr<Searcher>> searchers;
+    std::map<KernelId, std::unique_ptr<Searcher>> customSearchers;
+    std::map<KernelId, std::vector<std::vector<ParameterPair>>> warmStartConfigurations;
     std::map<KernelId, KernelResult> bestConfigurations;
+    std::map<KernelId, ComputationResult> bestComputationResults;
+    std::map<KernelId, std::vector<TuningObjective>> objectives;
+    std::map<KernelId, std::vector<ComputationResult>> paretoFronts;
     std::map<KernelId, ConfigurationStorage> configurationStorages;
     SearchMethod searchMethod;
     std::vector<double> searchArguments;
@@ -81,6 +97,14 @@ private:
     KernelParameterPack getCurrentParameterPack(const KernelComposition& composition) const;
     void initializeSearcher(const KernelId id, const SearchMethod method, const std::vector<double>& arguments,
         const std::vector<KernelConfiguration>& configurations);
+    Searcher* findSearcher(const KernelId id) const;
+    void resetSearcher(const KernelId id);
+    static KernelConfiguration getNextSearcherConfiguration(const Searcher& searcher);
+    ComputationResult processResult(const KernelId id, const KernelResult& result);
+    ComputationResult evaluateObjectives(const KernelId id, const ComputationResult& result) const;
+    void updateParetoFront(const KernelId id, const ComputationResult& result);
+    void clearBestResults(const KernelId id);
+    static bool dominates(const ComputationResult& first, const ComputationResult& second);
     static bool checkParameterPairs(const std::vector<ParameterPair>& pairs, const std::vector<KernelConstraint>& constraints);
     static size_t getConfigurationCountForParameters(const std::vector<KernelParameter>& parameters);
     static std::string getSearchMethodName(const SearchMethod method);
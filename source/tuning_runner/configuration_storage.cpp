@@ -5,7 +5,7 @@
 namespace ktt
 {
 
-void ConfigurationStorage::storeConfiguration(const std::pair<KernelConfiguration, uint64_t>& configuration)
+void ConfigurationStorage::storeConfiguration(const std::pair<KernelConfiguration, double>& configuration)
 {
     orderedConfigurations.insert(std::make_pair(configuration.second, configuration.first));
 }
@@ -11,14 +11,14 @@ namespace ktt
 class ConfigurationStorage
 {
 public:
-    void storeConfiguration(const std::pair<KernelConfiguration, uint64_t>& configuration);
+    void storeConfiguration(const std::pair<KernelConfiguration, double>& configuration);
     void storeProcessedPack(const KernelParameterPack& pack);
     KernelConfiguration getBestCompatibleConfiguration(const KernelParameterPack& currentPack,
         const std::vector<ParameterPair>& generatedPairs) const;
 
 private:
     std::vector<KernelParameterPack> processedPacks;
-    std::multimap<uint64_t, KernelConfiguration> orderedConfigurations;
+    std::multimap<double, KernelConfiguration> orderedConfigurations;
 
     bool isConfigurationCompatible(const KernelConfiguration& configuration, const KernelParameterPack& currentPack,
         const std::vector<ParameterPair>& generatedPairs) const;
@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <tuning_runner/interference_detector.h>
+
+namespace ktt
+{
+
+InterferenceDetector::InterferenceDetector() :
+    sentinelInterval(0),
+    driftThreshold(0.0),
+    loadThreshold(0.0),
+    sentinelDuration(0),
+    lastSentinelCheck(0),
+    sentinelValid(false),
+    previousCheckDrifted(false)
+{}
+
+void InterferenceDetector::setParameters(const size_t sentinelInterval, const double driftThreshold, const double loadThreshold)
+{
+    if (driftThreshold < 0.0 || loadThreshold < 0.0)
+    {
+        throw std::runtime_error("Interference detection thresholds must not be negative");
+    }
+
+    this->sentinelInterval = sentinelInterval;
+    this->driftThreshold = driftThreshold;
+    this->loadThreshold = loadThreshold;
+    reset();
+}
+
+bool InterferenceDetector::isEnabled() const
+{
+    return isSentinelEnabled() || loadThreshold > 0.0;
+}
+
+bool InterferenceDetector::isSentinelEnabled() const
+{
+    return sentinelInterval > 0 && driftThreshold > 0.0;
+}
+
+void InterferenceDetector::reset()
+{
+    clearSentinel();
+    affectedMeasurements.clear();
+    loadMeasurements.clear();
+    hostLoadMonitor = HostLoadMonitor();
+}
+
+void InterferenceDetector::beginMeasurement()
+{
+    if (loadThreshold > 0.0)
+    {
+        hostLoadMonitor.start();
+    }
+}
+
+bool InterferenceDetector::endMeasurement(const size_t measurementIndex)
+{
+    if (loadThreshold <= 0.0)
+    {
+        return false;
+    }
+
+    hostLoadMonitor.stop();
+    loadMeasurements.push_back(measurementIndex);
+
+    if (!hostLoadMonitor.hasLoad())
+    {
+        return false;
+    }
+
+    // Load is known once the window reaches minimum length, it applies to all measurements inside the window
+    const bool highLoad = hostLoadMonitor.getLoad() > loadThreshold;
+    if (highLoad)
+    {
+        affectedMeasurements.insert(loadMeasurements.cbegin(), loadMeasurements.cend());
+    }
+
+    loadMeasurements.clear();
+    return highLoad;
+}
+
+bool InterferenceDetector::hasSentinel() const
+{
+    return sentinelValid;
+}
+
+bool InterferenceDetector::isSentinelDue(const size_t measurementCount) const
+{
+    return sentinelValid && measurementCount >= lastSentinelCheck + sentinelInterval;
+}
+
+void InterferenceDetector::setSentinel(const std::vector<ParameterPair>& configuration, const uint64_t duration, const size_t measurementCount)
+{
+    sentinelConfiguration = configuration;
+    sentinelDuration = duration;
+    lastSentinelCheck = measurementCount;
+    sentinelValid = true;
+    previousCheckDrifted = false;
+}
+
+const std::vector<ParameterPair>& InterferenceDetector::getSentinel() const
+{
+    return sentinelConfiguration;
+}
+
+bool InterferenceDetector::checkSentinel(const uint64_t duration, const size_t measurementCount)
+{
+    const double drift = std::fabs(static_cast<double>(duration) - static_cast<double>(sentinelDuration))
+        / std::max(static_cast<double>(sentinelDuration), 1.0);
+    const bool drifted = drift > driftThreshold;
+
+    // It is not known when exactly the drift started or ended, so measurements between checks are flagged if either check drifted
+    if (drifted || previousCheckDrifted)
+    {
+        for (size_t i = lastSentinelCheck; i < measurementCount; ++i)
+        {
+            affectedMeasurements.insert(i);
+        }
+    }
+
+    lastSentinelCheck = measurementCount;
+    previousCheckDrifted = drifted;
+    return drifted;
+}
+
+void InterferenceDetector::clearSentinel()
+{
+    sentinelConfiguration.clear();
+    sentinelDuration = 0;
+    lastSentinelCheck = 0;
+    sentinelValid = false;
+    previousCheckDrifted = false;
+}
+
+const std::set<size_t>& InterferenceDetector::getAffectedMeasurements() const
+{
+    return affectedMeasurements;
+}
+
+} // namespace ktt
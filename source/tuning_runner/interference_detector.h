@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <vector>
+#include <api/parameter_pair.h>
+#include <utility/host_load_monitor.h>
+
+namespace ktt
+{
+
+class InterferenceDetector
+{
+public:
+    InterferenceDetector();
+
+    void setParameters(const size_t sentinelInterval, const double driftThreshold, const double loadThreshold);
+    bool isEnabled() const;
+    bool isSentinelEnabled() const;
+    void reset();
+
+    void beginMeasurement();
+    bool endMeasurement(const size_t measurementIndex);
+
+    bool hasSentinel() const;
+    bool isSentinelDue(const size_t measurementCount) const;
+    void setSentinel(const std::vector<ParameterPair>& configuration, const uint64_t duration, const size_t measurementCount);
+    const std::vector<ParameterPair>& getSentinel() const;
+    bool checkSentinel(const uint64_t duration, const size_t measurementCount);
+    void clearSentinel();
+
+    const std::set<size_t>& getAffectedMeasurements() const;
+
+private:
+    size_t sentinelInterval;
+    double driftThreshold;
+    double loadThreshold;
+    HostLoadMonitor hostLoadMonitor;
+    std::vector<size_t> loadMeasurements;
+    std::vector<ParameterPair> sentinelConfiguration;
+    uint64_t sentinelDuration;
+    size_t lastSentinelCheck;
+    bool sentinelValid;
+    bool previousCheckDrifted;
+    std::set<size_t> affectedMeasurements;
+};
+
+} // namespace ktt
@@ -1,5 +1,8 @@
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iterator>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -18,7 +21,16 @@ KernelRunner::KernelRunner(ArgumentManager* argumentManager, KernelManager* kern
     resultValidator(argumentManager, this),
     manipulatorInterfaceImplementation(std::make_unique<ManipulatorInterfaceImplementation>(computeEngine)),
     timeUnit(TimeUnit::Milliseconds),
-    kernelProfilingFlag(false)
+    kernelProfilingFlag(false),
+    compilerOptionDefinitionsFlag(false),
+    warmUpRuns(0),
+    timedRuns(1),
+    maximumTimedRuns(1),
+    relativeConfidenceInterval(0.0),
+    adaptiveMeasurementFlag(false),
+    racingFactor(0.0),
+    measurementStatistic(MeasurementStatistic::Median),
+    asynchronousValidationFlag(false)
 {}
 
 KernelResult KernelRunner::runKernel(const KernelId id, const KernelRunMode mode, const KernelConfiguration& configuration,
@@ -42,17 +54,25 @@ KernelResult KernelRunner::runKernel(const KernelId id, const KernelRunMode mode
     KernelResult result;
     try
     {
-        if (kernel.hasTuningManipulator())
+        result = runRepeatedly(id, mode, output, [this, id, &kernel, mode, &configuration](const std::vector<OutputDescriptor>& runOutput)
         {
-            auto manipulatorPointer = tuningManipulators.find(id);
-            result = runKernelWithManipulator(kernel, mode, manipulatorPointer->second.get(), configuration, output);
-        }
-        else
-        {
-            result = runKernelSimple(kernel, mode, configuration, output);
-        }
+            if (kernel.hasTuningManipulator())
+            {
+                auto manipulatorPointer = tuningManipulators.find(id);
+                return runKernelWithManipulator(kernel, mode, manipulatorPointer->second.get(), configuration, runOutput);
+            }
+
+            return runKernelSimple(kernel, mode, configuration, runOutput);
+        });
         validateResult(kernel, result, mode);
     }
+    catch (const RacingTerminationError& error)
+    {
+        computeEngine->synchronizeDevice();
+        computeEngine->clearEvents();
+        Logger::getLogger().log(LoggingLevel::Info, std::string("Kernel run terminated early, reason: ") + error.what());
+        result = getCensoredResult(kernel.getName(), configuration, error);
+    }
     catch (const std::runtime_error& error)
     {
         computeEngine->synchronizeDevice();
@@ -94,9 +114,20 @@ KernelResult KernelRunner::runComposition(const KernelId id, const KernelRunMode
     try
     {
         auto manipulatorPointer = tuningManipulators.find(id);
-        result = runCompositionWithManipulator(composition, mode, manipulatorPointer->second.get(), configuration, output);
+        result = runRepeatedly(id, mode, output, [this, &composition, mode, &manipulatorPointer, &configuration](
+            const std::vector<OutputDescriptor>& runOutput)
+        {
+            return runCompositionWithManipulator(composition, mode, manipulatorPointer->second.get(), configuration, runOutput);
+        });
         validateResult(compatibilityKernel, result, mode);
     }
+    catch (const RacingTerminationError& error)
+    {
+        computeEngine->synchronizeDevice();
+        computeEngine->clearEvents();
+        Logger::getLogger().log(LoggingLevel::Info, std::string("Kernel composition run terminated early, reason: ") + error.what());
+        result = getCensoredResult(composition.getName(), configuration, error);
+    }
     catch (const std::runtime_error& error)
     {
         computeEngine->synchronizeDevice();
@@ -115,6 +146,41 @@ KernelResult KernelRunner::runComposition(const KernelId id, const KernelRunMode
     return runComposition(id, mode, launchConfiguration, output);
 }
 
+void KernelRunner::precompileKernel(const KernelId id, const KernelConfiguration& configuration, const bool speculative)
+{
+    if (!kernelManager->isComposition(id))
+    {
+        const Kernel& kernel = kernelManager->getKernel(id);
+        std::string source = getKernelSource(id, configuration);
+
+        KernelRuntimeData kernelData(id, kernel.getName(), source, kernel.getSource(), configuration.getGlobalSize(),
+            configuration.getLocalSize(), configuration.getParameterPairs(), kernel.getArgumentIds(), configuration.getLocalMemoryModifiers());
+        kernelData.setCompilerOptions(getParameterDefinitions(id, configuration));
+        computeEngine->precompileKernel(kernelData, speculative);
+        return;
+    }
+
+    const KernelComposition& composition = kernelManager->getKernelComposition(id);
+
+    for (const auto* kernel : composition.getKernels())
+    {
+        KernelId kernelId = kernel->getId();
+        std::string source = getKernelSource(kernelId, configuration);
+
+        KernelRuntimeData kernelData(kernelId, kernel->getName(), source, kernel->getSource(),
+            configuration.getCompositionKernelGlobalSize(kernelId), configuration.getCompositionKernelLocalSize(kernelId),
+            configuration.getParameterPairs(), composition.getKernelArgumentIds(kernelId),
+            configuration.getCompositionKernelLocalMemoryModifiers(kernelId));
+        kernelData.setCompilerOptions(getParameterDefinitions(kernelId, configuration));
+        computeEngine->precompileKernel(kernelData, speculative);
+    }
+}
+
+std::map<std::string, uint64_t> KernelRunner::getCompilationFailureCauses() const
+{
+    return computeEngine->getCompilationFailureCauses();
+}
+
 void KernelRunner::setTuningManipulator(const KernelId id, std::unique_ptr<TuningManipulator> manipulator)
 {
     if (tuningManipulators.find(id) != tuningManipulators.end())
@@ -147,17 +213,88 @@ void KernelRunner::setKernelProfiling(const bool flag)
     manipulatorInterfaceImplementation->setKernelProfiling(flag);
 }
 
+void KernelRunner::setParameterDefinitionsAsCompilerOptions(const bool flag)
+{
+    compilerOptionDefinitionsFlag = flag;
+}
+
 bool KernelRunner::getKernelProfiling()
 {
     return kernelProfilingFlag;
 }
 
+void KernelRunner::setMeasurementRepetitions(const size_t warmUpRuns, const size_t timedRuns)
+{
+    if (timedRuns == 0)
+    {
+        throw std::runtime_error("Number of timed measurement runs must be greater than zero");
+    }
+
+    this->warmUpRuns = warmUpRuns;
+    this->timedRuns = timedRuns;
+    this->maximumTimedRuns = timedRuns;
+    this->adaptiveMeasurementFlag = false;
+}
+
+void KernelRunner::setAdaptiveMeasurement(const double relativeConfidenceInterval, const size_t maximumTimedRuns)
+{
+    if (relativeConfidenceInterval < 0.0)
+    {
+        throw std::runtime_error("Relative confidence interval must not be negative");
+    }
+
+    this->relativeConfidenceInterval = relativeConfidenceInterval;
+    this->maximumTimedRuns = std::max(maximumTimedRuns, timedRuns);
+    this->adaptiveMeasurementFlag = maximumTimedRuns > timedRuns;
+}
+
+void KernelRunner::setIncumbentDuration(const KernelId id, const uint64_t duration)
+{
+    incumbentDurations[id] = duration;
+}
+
+void KernelRunner::clearIncumbentDuration(const KernelId id)
+{
+    incumbentDurations.erase(id);
+}
+
+void KernelRunner::setMeasurementRacing(const double factor)
+{
+    if (factor != 0.0 && factor < 1.0)
+    {
+        throw std::runtime_error("Racing factor must be either zero or at least one");
+    }
+
+    racingFactor = factor;
+}
+
+void KernelRunner::setMeasurementStatistic(const MeasurementStatistic statistic)
+{
+    measurementStatistic = statistic;
+}
+
+MeasurementStatistic KernelRunner::getMeasurementStatistic() const
+{
+    return measurementStatistic;
+}
+
 void KernelRunner::setValidationMethod(const ValidationMethod method, const double toleranceThreshold)
 {
+    // Checked before any setting is changed, so that fractional threshold is never truncated to smaller distance
+    if (method == ValidationMethod::SideBySideUlpComparison && toleranceThreshold != std::floor(toleranceThreshold))
+    {
+        throw std::runtime_error("Tolerance threshold of comparison in units in the last place has to be an integer");
+    }
+
     resultValidator.setValidationMethod(method);
     resultValidator.setToleranceThreshold(toleranceThreshold);
 }
 
+void KernelRunner::setRelativeValidationFloor(const double floor)
+{
+    resultValidator.setRelativeValidationFloor(floor);
+}
+
 void KernelRunner::setValidationMode(const ValidationMode mode)
 {
     resultValidator.setValidationMode(mode);
@@ -190,11 +327,59 @@ void KernelRunner::clearReferenceResult(const KernelId id)
     resultValidator.clearReferenceResults(id);
 }
 
+void KernelRunner::setAsynchronousValidation(const bool flag)
+{
+    asynchronousValidationFlag = flag;
+
+    if (!flag)
+    {
+        resultValidator.waitForPendingValidation();
+    }
+}
+
+std::vector<KernelResult> KernelRunner::getInvalidatedResults()
+{
+    std::vector<KernelResult> results;
+
+    for (auto& validation : resultValidator.retrieveCompletedValidations())
+    {
+        if (validation.second)
+        {
+            continue;
+        }
+
+        KernelResult& result = validation.first;
+        std::stringstream stream;
+        stream << "Results of kernel " << result.getKernelName() << " with configuration: " << result.getConfiguration() << " differ";
+        Logger::logWarning(stream.str());
+        result.setErrorMessage("Results differ");
+        result.setValid(false);
+        results.push_back(result);
+    }
+
+    return results;
+}
+
+bool KernelRunner::isValidationPending(const ComputationResult& result) const
+{
+    return resultValidator.isValidationPending(result.getKernelName(), result.getConfiguration());
+}
+
 KernelArgument KernelRunner::downloadArgument(const ArgumentId id) const
 {
     return computeEngine->downloadArgumentObject(id, nullptr);
 }
 
+void KernelRunner::downloadArgument(const ArgumentId id, void* destination, const size_t dataSizeInBytes) const
+{
+    computeEngine->downloadArgument(id, destination, dataSizeInBytes);
+}
+
+size_t KernelRunner::getArgumentBufferSize(const ArgumentId id) const
+{
+    return computeEngine->getArgumentBufferSize(id);
+}
+
 void KernelRunner::clearBuffers(const ArgumentAccessType accessType)
 {
     computeEngine->clearBuffers(accessType);
@@ -210,15 +395,159 @@ void KernelRunner::setPersistentArgumentUsage(const bool flag)
     computeEngine->setPersistentBufferUsage(flag);
 }
 
+KernelResult KernelRunner::runRepeatedly(const KernelId id, const KernelRunMode mode, const std::vector<OutputDescriptor>& output,
+    const std::function<KernelResult(const std::vector<OutputDescriptor>&)>& runFunction)
+{
+    const bool adaptive = adaptiveMeasurementFlag;
+
+    // Profiling runs are already repeated by compute engine until all counters are gathered
+    if ((mode != KernelRunMode::OfflineTuning && mode != KernelRunMode::OnlineTuning) || kernelProfilingFlag
+        || (warmUpRuns == 0 && timedRuns == 1 && !adaptive))
+    {
+        return runFunction(output);
+    }
+
+    for (size_t i = 0; i < warmUpRuns; ++i)
+    {
+        runFunction(std::vector<OutputDescriptor>{});
+        computeEngine->clearBuffers(ArgumentAccessType::ReadWrite);
+        computeEngine->clearBuffers(ArgumentAccessType::WriteOnly);
+    }
+
+    std::vector<uint64_t> durations;
+    std::vector<uint64_t> kernelTimes;
+    KernelResult result;
+
+    while (true)
+    {
+        // In adaptive mode the last run is not known in advance, so output is retrieved after each run
+        const bool lastFixedRun = !adaptive && durations.size() + 1 == timedRuns;
+
+        try
+        {
+            result = runFunction(adaptive || lastFixedRun ? output : std::vector<OutputDescriptor>{});
+        }
+        catch (RacingTerminationError& error)
+        {
+            error.setCompletedRuns(durations, kernelTimes);
+            throw;
+        }
+
+        durations.push_back(result.getComputationDuration());
+        kernelTimes.push_back(result.getKernelTime());
+
+        // Remaining runs of configuration which is already much slower than the best one would not change the outcome
+        if (lastFixedRun || (adaptive && isMeasurementFinished(id, MeasurementStatistics(durations)))
+            || result.getComputationDuration() > getRacingTimeLimit(id, mode))
+        {
+            break;
+        }
+
+        // Buffers are restored before each run so that output of the last run can be validated
+        computeEngine->clearBuffers(ArgumentAccessType::ReadWrite);
+        computeEngine->clearBuffers(ArgumentAccessType::WriteOnly);
+    }
+
+    const MeasurementStatistics statistics(durations);
+    result.setComputationDuration(statistics.getStatistic(measurementStatistic));
+    result.setKernelTime(MeasurementStatistics(kernelTimes).getStatistic(measurementStatistic));
+    result.setMeasurementStatistics(statistics);
+    return result;
+}
+
+bool KernelRunner::isMeasurementFinished(const KernelId id, const MeasurementStatistics& statistics) const
+{
+    const size_t count = statistics.getMeasurementCount();
+    if (count < std::max(timedRuns, static_cast<size_t>(2)))
+    {
+        return false;
+    }
+
+    if (count >= maximumTimedRuns)
+    {
+        return true;
+    }
+
+    const double mean = statistics.getMean();
+    const double halfWidth = statistics.getConfidenceIntervalHalfWidth();
+
+    if (halfWidth <= relativeConfidenceInterval * mean)
+    {
+        return true;
+    }
+
+    // Configuration which is certainly slower than the best one does not need to be measured precisely
+    auto incumbent = incumbentDurations.find(id);
+    return incumbent != incumbentDurations.end() && mean - halfWidth > static_cast<double>(incumbent->second);
+}
+
+uint64_t KernelRunner::getRacingTimeLimit(const KernelId id, const KernelRunMode mode) const
+{
+    auto incumbent = incumbentDurations.find(id);
+    if (racingFactor == 0.0 || kernelProfilingFlag || (mode != KernelRunMode::OfflineTuning && mode != KernelRunMode::OnlineTuning)
+        || incumbent == incumbentDurations.end())
+    {
+        return std::numeric_limits<uint64_t>::max();
+    }
+
+    const double limit = static_cast<double>(incumbent->second) * racingFactor;
+    if (limit >= static_cast<double>(std::numeric_limits<uint64_t>::max()))
+    {
+        return std::numeric_limits<uint64_t>::max();
+    }
+
+    return static_cast<uint64_t>(limit);
+}
+
+std::string KernelRunner::getKernelSource(const KernelId id, const KernelConfiguration& configuration) const
+{
+    if (compilerOptionDefinitionsFlag)
+    {
+        return kernelManager->getKernel(id).getSource();
+    }
+
+    return kernelManager->getKernelSourceWithDefines(id, configuration);
+}
+
+std::string KernelRunner::getParameterDefinitions(const KernelId id, const KernelConfiguration& configuration) const
+{
+    if (!compilerOptionDefinitionsFlag)
+    {
+        return "";
+    }
+
+    return kernelManager->getParameterDefinitions(id, configuration);
+}
+
+KernelResult KernelRunner::getCensoredResult(const std::string& kernelName, const KernelConfiguration& configuration,
+    const RacingTerminationError& error) const
+{
+    // Elapsed time of the terminated run is only a lower bound for its real duration. Replacing any run with a shorter one never increases
+    // the statistic, so statistic of completed runs together with the terminated run is a lower bound as well.
+    std::vector<uint64_t> durations = error.getCompletedDurations();
+    std::vector<uint64_t> kernelTimes = error.getCompletedKernelTimes();
+    durations.push_back(error.getElapsedTime());
+    kernelTimes.push_back(error.getElapsedTime());
+
+    const MeasurementStatistics statistics(durations);
+    KernelResult result(kernelName, configuration);
+    result.setComputationDuration(statistics.getStatistic(measurementStatistic));
+    result.setKernelTime(MeasurementStatistics(kernelTimes).getStatistic(measurementStatistic));
+    result.setMeasurementStatistics(statistics);
+    result.setCensored(true);
+    return result;
+}
+
 KernelResult KernelRunner::runKernelSimple(const Kernel& kernel, const KernelRunMode mode, const KernelConfiguration& configuration,
     const std::vector<OutputDescriptor>& output)
 {
     KernelId kernelId = kernel.getId();
     const std::string& kernelName = kernel.getName();
-    std::string source = kernelManager->getKernelSourceWithDefines(kernelId, configuration);
+    std::string source = getKernelSource(kernelId, configuration);
     
     KernelRuntimeData kernelData(kernelId, kernelName, source, kernel.getSource(), configuration.getGlobalSize(), configuration.getLocalSize(),
         configuration.getParameterPairs(), kernel.getArgumentIds(), configuration.getLocalMemoryModifiers());
+    kernelData.setCompilerOptions(getParameterDefinitions(kernelId, configuration));
 
     KernelResult result;
     if (kernelProfilingFlag)
@@ -244,9 +573,9 @@ KernelResult KernelRunner::runSimpleKernelProfiling(const Kernel& kernel, const
 
     if (mode == KernelRunMode::OfflineTuning)
     {
-        while (computeEngine->getRemainingKernelProfilingRuns(kernelData.getName(), kernelData.getSource()) > 0)
+        while (computeEngine->getRemainingKernelProfilingRuns(kernelData.getProgramName(), kernelData.getSource()) > 0)
         {
-            if (computeEngine->getRemainingKernelProfilingRuns(kernelData.getName(), kernelData.getSource()) > 1)
+            if (computeEngine->getRemainingKernelProfilingRuns(kernelData.getProgramName(), kernelData.getSource()) > 1)
             {
                 computeEngine->clearBuffers(ArgumentAccessType::ReadWrite);
                 computeEngine->clearBuffers(ArgumentAccessType::WriteOnly);
@@ -258,7 +587,7 @@ KernelResult KernelRunner::runSimpleKernelProfiling(const Kernel& kernel, const
     }
     else
     {
-        const uint64_t remainingRuns = computeEngine->getRemainingKernelProfilingRuns(kernelData.getName(), kernelData.getSource());
+        const uint64_t remainingRuns = computeEngine->getRemainingKernelProfilingRuns(kernelData.getProgramName(), kernelData.getSource());
         if (remainingRuns == 0)
         {
             result = computeEngine->getKernelResultWithProfiling(id, output);
@@ -277,15 +606,17 @@ KernelResult KernelRunner::runKernelWithManipulator(const Kernel& kernel, const
     const KernelConfiguration& configuration, const std::vector<OutputDescriptor>& output)
 {
     KernelId kernelId = kernel.getId();
-    std::string source = kernelManager->getKernelSourceWithDefines(kernelId, configuration);
+    std::string source = getKernelSource(kernelId, configuration);
 
     KernelRuntimeData kernelData(kernelId, kernel.getName(), source, kernel.getSource(), configuration.getGlobalSize(), configuration.getLocalSize(),
         configuration.getParameterPairs(), kernel.getArgumentIds(), configuration.getLocalMemoryModifiers());
+    kernelData.setCompilerOptions(getParameterDefinitions(kernelId, configuration));
 
     manipulator->manipulatorInterface = manipulatorInterfaceImplementation.get();
     manipulatorInterfaceImplementation->addKernel(kernelId, kernelData);
     manipulatorInterfaceImplementation->setConfiguration(configuration);
     manipulatorInterfaceImplementation->setKernelArguments(argumentManager->getArguments(kernel.getArgumentIds()));
+    manipulatorInterfaceImplementation->setKernelTimeLimit(getRacingTimeLimit(kernelId, mode));
 
     uint64_t manipulatorDuration;
     KernelResult result;
@@ -295,7 +626,7 @@ KernelResult KernelRunner::runKernelWithManipulator(const Kernel& kernel, const
         if (kernelProfilingFlag)
         {
             manipulatorDuration = runManipulatorKernelProfiling(kernel, mode, manipulator, kernelData, output);
-            const uint64_t remainingRuns = computeEngine->getRemainingKernelProfilingRuns(kernelData.getName(), kernelData.getSource());
+            const uint64_t remainingRuns = computeEngine->getRemainingKernelProfilingRuns(kernelData.getProgramName(), kernelData.getSource());
             result = manipulatorInterfaceImplementation->getCurrentResult(remainingRuns);
         }
         else
@@ -304,7 +635,7 @@ KernelResult KernelRunner::runKernelWithManipulator(const Kernel& kernel, const
             result = manipulatorInterfaceImplementation->getCurrentResult();
         }
     }
-    catch (const std::runtime_error&)
+    catch (...)
     {
         manipulatorInterfaceImplementation->synchronizeDeviceInternal();
         manipulatorInterfaceImplementation->clearData();
@@ -328,7 +659,7 @@ uint64_t KernelRunner::runManipulatorKernelProfiling(const Kernel& kernel, const
     const KernelId kernelId = kernel.getId();
     manipulatorInterfaceImplementation->setProfiledKernels(std::set<KernelId>{kernelId});
     computeEngine->initializeKernelProfiling(kernelData);
-    uint64_t remainingCount = computeEngine->getRemainingKernelProfilingRuns(kernelData.getName(), kernelData.getSource());
+    uint64_t remainingCount = computeEngine->getRemainingKernelProfilingRuns(kernelData.getProgramName(), kernelData.getSource());
     uint64_t manipulatorDuration = 0;
 
     if (mode == KernelRunMode::OfflineTuning)
@@ -336,7 +667,7 @@ uint64_t KernelRunner::runManipulatorKernelProfiling(const Kernel& kernel, const
         while (remainingCount > 0)
         {
             manipulatorDuration = launchManipulator(kernelId, manipulator);
-            uint64_t newCount = computeEngine->getRemainingKernelProfilingRuns(kernelData.getName(), kernelData.getSource());
+            uint64_t newCount = computeEngine->getRemainingKernelProfilingRuns(kernelData.getProgramName(), kernelData.getSource());
 
             if (computeEngine->hasAccurateRemainingKernelProfilingRuns() && newCount == remainingCount)
             {
@@ -356,7 +687,7 @@ uint64_t KernelRunner::runManipulatorKernelProfiling(const Kernel& kernel, const
     else
     {
         manipulatorDuration = launchManipulator(kernelId, manipulator);
-        uint64_t newCount = computeEngine->getRemainingKernelProfilingRuns(kernelData.getName(), kernelData.getSource());
+        uint64_t newCount = computeEngine->getRemainingKernelProfilingRuns(kernelData.getProgramName(), kernelData.getSource());
 
         if (computeEngine->hasAccurateRemainingKernelProfilingRuns() && newCount == remainingCount)
         {
@@ -380,11 +711,12 @@ KernelResult KernelRunner::runCompositionWithManipulator(const KernelComposition
     {
         KernelId kernelId = kernel->getId();
         std::vector<ArgumentId> argumentIds = composition.getKernelArgumentIds(kernelId);
-        std::string source = kernelManager->getKernelSourceWithDefines(kernelId, configuration);
+        std::string source = getKernelSource(kernelId, configuration);
 
         KernelRuntimeData kernelData(kernelId, kernel->getName(), source, kernel->getSource(),
             configuration.getCompositionKernelGlobalSize(kernelId), configuration.getCompositionKernelLocalSize(kernelId),
             configuration.getParameterPairs(), argumentIds, configuration.getCompositionKernelLocalMemoryModifiers(kernelId));
+        kernelData.setCompilerOptions(getParameterDefinitions(kernelId, configuration));
         manipulatorInterfaceImplementation->addKernel(kernelId, kernelData);
         compositionData.push_back(kernelData);
 
@@ -400,6 +732,7 @@ KernelResult KernelRunner::runCompositionWithManipulator(const KernelComposition
 
     manipulatorInterfaceImplementation->setConfiguration(configuration);
     manipulatorInterfaceImplementation->setKernelArguments(allArguments);
+    manipulatorInterfaceImplementation->setKernelTimeLimit(getRacingTimeLimit(compositionId, mode));
     uint64_t manipulatorDuration;
     KernelResult result;
 
@@ -417,7 +750,7 @@ KernelResult KernelRunner::runCompositionWithManipulator(const KernelComposition
             result = manipulatorInterfaceImplementation->getCurrentResult();
         }
     }
-    catch (const std::runtime_error&)
+    catch (...)
     {
         manipulatorInterfaceImplementation->synchronizeDeviceInternal();
         manipulatorInterfaceImplementation->clearData();
@@ -507,8 +840,9 @@ uint64_t KernelRunner::launchManipulator(const KernelId kernelId, TuningManipula
         }
         timer.stop();
     }
-    catch (const std::runtime_error&)
+    catch (...)
     {
+        // Racing termination is not derived from std::exception, cleanup is performed for all errors
         manipulatorInterfaceImplementation->synchronizeDeviceInternal();
         manipulatorInterfaceImplementation->clearData();
         manipulator->manipulatorInterface = nullptr;
@@ -528,7 +862,7 @@ uint64_t KernelRunner::getRemainingKernelProfilingRunsForComposition(const Kerne
     {
         if (profilingKernels.find(kernelData.getId()) != profilingKernels.end())
         {
-            count += computeEngine->getRemainingKernelProfilingRuns(kernelData.getName(), kernelData.getSource());
+            count += computeEngine->getRemainingKernelProfilingRuns(kernelData.getProgramName(), kernelData.getSource());
         }
     }
 
@@ -542,6 +876,16 @@ void KernelRunner::validateResult(const Kernel& kernel, KernelResult& result, co
         return;
     }
 
+    // Result is provisionally valid, its arguments are validated on worker thread while the next configuration runs
+    if (asynchronousValidationFlag && mode == KernelRunMode::OfflineTuning && resultValidator.validateArgumentsAsync(kernel, mode, result))
+    {
+        Logger::logInfo(std::string("Kernel run completed in ") + std::to_string(convertTime(result.getComputationDuration(), timeUnit))
+            + getTimeUnitTag(timeUnit)
+            + std::string(" (kernel time ") + std::to_string(convertTime(result.getKernelTime(), timeUnit))
+            + getTimeUnitTag(timeUnit) + "), results are being validated");
+        return;
+    }
+
     const bool resultIsCorrect = resultValidator.validateArguments(kernel, mode);
 
     if (resultIsCorrect)
@@ -1,16 +1,21 @@
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <utility>
+#include <vector>
+#include <api/computation_result.h>
 #include <api/tuning_manipulator.h>
 #include <compute_engine/compute_engine.h>
 #include <dto/kernel_result.h>
 #include <enum/kernel_run_mode.h>
+#include <enum/measurement_statistic.h>
 #include <enum/time_unit.h>
 #include <kernel/kernel_manager.h>
 #include <kernel_argument/argument_manager.h>
 #include <tuning_runner/manipulator_interface_implementation.h>
+#include <tuning_runner/racing_termination_error.h>
 #include <tuning_runner/result_validator.h>
 
 namespace ktt
@@ -31,14 +36,25 @@ public:
         const std::vector<OutputDescriptor>& output);
     KernelResult runComposition(const KernelId id, const KernelRunMode mode, const std::vector<ParameterPair>& configuration,
         const std::vector<OutputDescriptor>& output);
+    void precompileKernel(const KernelId id, const KernelConfiguration& configuration, const bool speculative);
+    std::map<std::string, uint64_t> getCompilationFailureCauses() const;
     void setTuningManipulator(const KernelId id, std::unique_ptr<TuningManipulator> manipulator);
     void setTuningManipulatorSynchronization(const KernelId id, const bool flag);
     void setTimeUnit(const TimeUnit unit);
     void setKernelProfiling(const bool flag);
+    void setParameterDefinitionsAsCompilerOptions(const bool flag);
     bool getKernelProfiling();
+    void setMeasurementRepetitions(const size_t warmUpRuns, const size_t timedRuns);
+    void setMeasurementStatistic(const MeasurementStatistic statistic);
+    MeasurementStatistic getMeasurementStatistic() const;
+    void setAdaptiveMeasurement(const double relativeConfidenceInterval, const size_t maximumTimedRuns);
+    void setMeasurementRacing(const double factor);
+    void setIncumbentDuration(const KernelId id, const uint64_t duration);
+    void clearIncumbentDuration(const KernelId id);
 
     // Result validation methods
     void setValidationMethod(const ValidationMethod method, const double toleranceThreshold);
+    void setRelativeValidationFloor(const double floor);
     void setValidationMode(const ValidationMode mode);
     void setValidationRange(const ArgumentId id, const size_t range);
     void setArgumentComparator(const ArgumentId id, const std::function<bool(const void*, const void*)>& comparator);
@@ -46,9 +62,14 @@ public:
         const std::vector<ArgumentId>& validatedArgumentIds);
     void setReferenceClass(const KernelId id, std::unique_ptr<ReferenceClass> referenceClass, const std::vector<ArgumentId>& validatedArgumentIds);
     void clearReferenceResult(const KernelId id);
+    void setAsynchronousValidation(const bool flag);
+    std::vector<KernelResult> getInvalidatedResults();
+    bool isValidationPending(const ComputationResult& result) const;
 
     // Compute engine methods
     KernelArgument downloadArgument(const ArgumentId id) const;
+    void downloadArgument(const ArgumentId id, void* destination, const size_t dataSizeInBytes) const;
+    size_t getArgumentBufferSize(const ArgumentId id) const;
     void clearBuffers(const ArgumentAccessType accessType);
     void clearBuffers();
     void setPersistentArgumentUsage(const bool flag);
@@ -64,8 +85,26 @@ private:
     std::set<KernelId> disabledSynchronizationManipulators;
     TimeUnit timeUnit;
     bool kernelProfilingFlag;
+    bool compilerOptionDefinitionsFlag;
+    size_t warmUpRuns;
+    size_t timedRuns;
+    size_t maximumTimedRuns;
+    double relativeConfidenceInterval;
+    bool adaptiveMeasurementFlag;
+    double racingFactor;
+    MeasurementStatistic measurementStatistic;
+    std::map<KernelId, uint64_t> incumbentDurations;
+    bool asynchronousValidationFlag;
 
     // Helper methods
+    KernelResult runRepeatedly(const KernelId id, const KernelRunMode mode, const std::vector<OutputDescriptor>& output,
+        const std::function<KernelResult(const std::vector<OutputDescriptor>&)>& runFunction);
+    bool isMeasurementFinished(const KernelId id, const MeasurementStatistics& statistics) const;
+    uint64_t getRacingTimeLimit(const KernelId id, const KernelRunMode mode) const;
+    std::string getKernelSource(const KernelId id, const KernelConfiguration& configuration) const;
+    std::string getParameterDefinitions(const KernelId id, const KernelConfiguration& configuration) const;
+    KernelResult getCensoredResult(const std::string& kernelName, const KernelConfiguration& configuration,
+        const RacingTerminationError& error) const;
     KernelResult runKernelSimple(const Kernel& kernel, const KernelRunMode mode, const KernelConfiguration& configuration,
         const std::vector<OutputDescriptor>& output);
     KernelResult runSimpleKernelProfiling(const Kernel& kernel, const KernelRunMode mode, const KernelRuntimeData& kernelData,
@@ -1,6 +1,8 @@
+#include <limits>
 #include <stdexcept>
 #include <utility>
 #include <tuning_runner/manipulator_interface_implementation.h>
+#include <tuning_runner/racing_termination_error.h>
 #include <utility/ktt_utility.h>
 #include <utility/logger.h>
 #include <utility/timer.h>
@@ -12,7 +14,8 @@ ManipulatorInterfaceImplementation::ManipulatorInterfaceImplementation(ComputeEn
     computeEngine(computeEngine),
     currentConfiguration(KernelConfiguration()),
     currentResult("", currentConfiguration),
-    kernelProfilingFlag(false)
+    kernelProfilingFlag(false),
+    kernelTimeLimit(std::numeric_limits<uint64_t>::max())
 {}
 
 void ManipulatorInterfaceImplementation::runKernel(const KernelId id)
@@ -59,6 +62,8 @@ void ManipulatorInterfaceImplementation::runKernel(const KernelId id, const Dime
     {
         currentResult.setCompilationData(result.getCompilationData());
     }
+
+    checkKernelTimeLimit();
 }
 
 void ManipulatorInterfaceImplementation::runKernelAsync(const KernelId id, const DimensionVector& globalSize, const DimensionVector& localSize,
@@ -138,7 +143,7 @@ uint64_t ManipulatorInterfaceImplementation::getRemainingKernelProfilingRuns(con
     {
         throw std::runtime_error(std::string("Kernel with following id is not present in tuning manipulator: ") + std::to_string(id));
     }
-    return computeEngine->getRemainingKernelProfilingRuns(dataPointer->second.getName(), dataPointer->second.getSource());
+    return computeEngine->getRemainingKernelProfilingRuns(dataPointer->second.getProgramName(), dataPointer->second.getSource());
 }
 
 QueueId ManipulatorInterfaceImplementation::getDefaultDeviceQueue() const
@@ -168,9 +173,17 @@ void ManipulatorInterfaceImplementation::synchronizeQueue(const QueueId queue)
         processBufferEvents(bufferEventPointer->second);
         enqueuedBufferEvents.erase(queue);
     }
+
+    checkKernelTimeLimit();
 }
 
 void ManipulatorInterfaceImplementation::synchronizeDevice()
+{
+    synchronizeDeviceEvents();
+    checkKernelTimeLimit();
+}
+
+void ManipulatorInterfaceImplementation::synchronizeDeviceEvents()
 {
     computeEngine->synchronizeDevice();
 
@@ -515,7 +528,7 @@ void ManipulatorInterfaceImplementation::synchronizeDeviceInternal()
 {
     if (!enqueuedKernelEvents.empty() || !enqueuedBufferEvents.empty())
     {
-        synchronizeDevice();
+        synchronizeDeviceEvents();
     }
 }
 
@@ -528,6 +541,7 @@ void ManipulatorInterfaceImplementation::clearData()
     nonVectorArguments.clear();
     kernelProfilingEvents.clear();
     profiledKernels.clear();
+    kernelTimeLimit = std::numeric_limits<uint64_t>::max();
 }
 
 void ManipulatorInterfaceImplementation::resetOverhead()
@@ -535,6 +549,11 @@ void ManipulatorInterfaceImplementation::resetOverhead()
     currentResult.setOverhead(0);
 }
 
+void ManipulatorInterfaceImplementation::setKernelTimeLimit(const uint64_t limit)
+{
+    kernelTimeLimit = limit;
+}
+
 void ManipulatorInterfaceImplementation::setProfiledKernels(const std::set<KernelId>& profiledKernels)
 {
     this->profiledKernels = profiledKernels;
@@ -705,4 +724,12 @@ void ManipulatorInterfaceImplementation::processBufferEvents(const std::set<std:
     }
 }
 
+void ManipulatorInterfaceImplementation::checkKernelTimeLimit() const
+{
+    if (currentResult.getKernelTime() > kernelTimeLimit)
+    {
+        throw RacingTerminationError(currentResult.getKernelTime(), kernelTimeLimit);
+    }
+}
+
 } // namespace ktt
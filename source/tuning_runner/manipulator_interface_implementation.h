@@ -64,6 +64,7 @@ public:
     void synchronizeDeviceInternal();
     void clearData();
     void resetOverhead();
+    void setKernelTimeLimit(const uint64_t limit);
     void setProfiledKernels(const std::set<KernelId>& profiledKernels);
 
 private:
@@ -79,6 +80,7 @@ private:
     mutable std::map<KernelId, std::vector<EventId>> kernelProfilingEvents;
     bool kernelProfilingFlag;
     std::set<KernelId> profiledKernels;
+    uint64_t kernelTimeLimit;
 
     // Helper methods
     bool isComposition() const;
@@ -89,6 +91,8 @@ private:
     void storeBufferEvent(const QueueId queue, const EventId event, const bool increaseOverhead) const;
     void processKernelEvents(const std::set<std::pair<KernelId, EventId>>& events);
     void processBufferEvents(const std::set<std::pair<EventId, bool>>& events);
+    void synchronizeDeviceEvents();
+    void checkKernelTimeLimit() const;
 };
 
 } // namespace ktt
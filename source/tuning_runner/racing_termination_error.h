@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ktt
+{
+
+// Terminates tuning manipulator once its kernel time exceeds racing limit. It is intentionally not derived from std::exception, so that
+// exception handlers inside user manipulators do not catch it.
+class RacingTerminationError
+{
+public:
+    explicit RacingTerminationError(const uint64_t elapsedTime, const uint64_t timeLimit) :
+        message(std::string("Kernel time ") + std::to_string(elapsedTime) + "ns exceeded racing limit " + std::to_string(timeLimit) + "ns"),
+        elapsedTime(elapsedTime)
+    {}
+
+    const char* what() const
+    {
+        return message.c_str();
+    }
+
+    uint64_t getElapsedTime() const
+    {
+        return elapsedTime;
+    }
+
+    // Timed runs of the same configuration which finished before the terminated one
+    void setCompletedRuns(const std::vector<uint64_t>& durations, const std::vector<uint64_t>& kernelTimes)
+    {
+        completedDurations = durations;
+        completedKernelTimes = kernelTimes;
+    }
+
+    const std::vector<uint64_t>& getCompletedDurations() const
+    {
+        return completedDurations;
+    }
+
+    const std::vector<uint64_t>& getCompletedKernelTimes() const
+    {
+        return completedKernelTimes;
+    }
+
+private:
+    std::string message;
+    uint64_t elapsedTime;
+    std::vector<uint64_t> completedDurations;
+    std::vector<uint64_t> completedKernelTimes;
+};
+
+} // namespace ktt
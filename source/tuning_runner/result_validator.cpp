@@ -1,8 +1,10 @@
+#include <cmath>
 #include <string>
 #include <utility>
 #include <tuning_runner/kernel_runner.h>
 #include <tuning_runner/result_validator.h>
 #include <utility/ktt_utility.h>
+#include <utility/result_printer.h>
 
 namespace ktt
 {
@@ -12,12 +14,16 @@ ResultValidator::ResultValidator(ArgumentManager* argumentManager, KernelRunner*
     kernelRunner(kernelRunner),
     toleranceThreshold(1e-4),
     validationMethod(ValidationMethod::SideBySideComparison),
-    validationMode(ValidationMode::OfflineTuning | ValidationMode::OnlineTuning)
+    validationMode(ValidationMode::OfflineTuning | ValidationMode::OnlineTuning),
+    activeResultBuffers(0),
+    validationPool(1)
 {}
 
 void ResultValidator::setReferenceKernel(const KernelId id, const KernelId referenceId, const std::vector<ParameterPair>& referenceConfiguration,
     const std::vector<ArgumentId>& validatedArgumentIds)
 {
+    waitForPendingValidation();
+
     if (referenceKernels.find(id) != referenceKernels.end())
     {
         referenceKernels.erase(id);
@@ -28,6 +34,8 @@ void ResultValidator::setReferenceKernel(const KernelId id, const KernelId refer
 void ResultValidator::setReferenceClass(const KernelId id, std::unique_ptr<ReferenceClass> referenceClass,
     const std::vector<ArgumentId>& validatedArgumentIds)
 {
+    waitForPendingValidation();
+
     if (referenceClasses.find(id) != referenceClasses.end())
     {
         referenceClasses.erase(id);
@@ -37,6 +45,8 @@ void ResultValidator::setReferenceClass(const KernelId id, std::unique_ptr<Refer
 
 void ResultValidator::setToleranceThreshold(const double threshold)
 {
+    waitForPendingValidation();
+
     if (threshold < 0.0)
     {
         throw std::runtime_error("Tolerance threshold cannot be negative");
@@ -46,16 +56,31 @@ void ResultValidator::setToleranceThreshold(const double threshold)
 
 void ResultValidator::setValidationMethod(const ValidationMethod method)
 {
+    waitForPendingValidation();
     this->validationMethod = method;
 }
 
+void ResultValidator::setRelativeValidationFloor(const double floor)
+{
+    waitForPendingValidation();
+
+    if (floor < 0.0 || std::isnan(floor))
+    {
+        throw std::runtime_error("Relative validation floor cannot be negative or NaN");
+    }
+    resultComparator.setRelativeComparisonFloor(floor);
+}
+
 void ResultValidator::setValidationMode(const ValidationMode mode)
 {
+    waitForPendingValidation();
     this->validationMode = mode;
 }
 
 void ResultValidator::setValidationRange(const ArgumentId id, const size_t range)
 {
+    waitForPendingValidation();
+
     if (argumentValidationRanges.find(id) != argumentValidationRanges.end())
     {
         argumentValidationRanges.erase(id);
@@ -65,6 +90,8 @@ void ResultValidator::setValidationRange(const ArgumentId id, const size_t range
 
 void ResultValidator::setArgumentComparator(const ArgumentId id, const std::function<bool(const void*, const void*)>& comparator)
 {
+    waitForPendingValidation();
+
     if (argumentComparators.find(id) != argumentComparators.end())
     {
         argumentComparators.erase(id);
@@ -85,14 +112,20 @@ void ResultValidator::computeReferenceResult(const Kernel& kernel, const KernelR
 
 void ResultValidator::clearReferenceResults()
 {
+    waitForPendingValidation();
     referenceClassResults.clear();
     referenceKernelResults.clear();
+    resultBuffers[0].clear();
+    resultBuffers[1].clear();
 }
 
 void ResultValidator::clearReferenceResults(const KernelId id)
 {
+    waitForPendingValidation();
     referenceClassResults.erase(id);
     referenceKernelResults.erase(id);
+    resultBuffers[0].clear();
+    resultBuffers[1].clear();
 }
 
 bool ResultValidator::validateArguments(const Kernel& kernel, const KernelRunMode runMode)
@@ -114,15 +147,8 @@ bool ResultValidator::validateArgumentsWithClass(const Kernel& kernel, const Ker
         return true; // reference class not present, no validation required
     }
 
-    std::vector<ArgumentId> argumentIds = std::get<1>(referenceClassPointer->second);
-    std::vector<KernelArgument> resultArguments;
-
-    for (const auto argumentId : argumentIds)
-    {
-        resultArguments.emplace_back(kernelRunner->downloadArgument(argumentId));
-    }
-
-    return validateArguments(resultArguments, referenceClassResults.find(kernelId)->second, kernel.getName());
+    const std::vector<const KernelArgument*> results = downloadResultArguments(std::get<1>(referenceClassPointer->second));
+    return validateArguments(results, referenceClassResults.find(kernelId)->second, kernel.getName());
 }
 
 bool ResultValidator::validateArgumentsWithKernel(const Kernel& kernel, const KernelRunMode runMode)
@@ -139,15 +165,88 @@ bool ResultValidator::validateArgumentsWithKernel(const Kernel& kernel, const Ke
         return true; // reference kernel not present, no validation required
     }
 
-    std::vector<ArgumentId> argumentIds = std::get<2>(referenceKernelPointer->second);
-    std::vector<KernelArgument> resultArguments;
+    const std::vector<const KernelArgument*> results = downloadResultArguments(std::get<2>(referenceKernelPointer->second));
+    return validateArguments(results, referenceKernelResults.find(kernelId)->second, kernel.getName());
+}
+
+bool ResultValidator::validateArgumentsAsync(const Kernel& kernel, const KernelRunMode runMode, const KernelResult& result)
+{
+    if (!isRunModeValidated(runMode))
+    {
+        return false;
+    }
+
+    const KernelId kernelId = kernel.getId();
+    std::vector<std::pair<std::vector<const KernelArgument*>, const std::vector<KernelArgument>*>> validations;
+
+    // Arguments are downloaded into the active set of result buffers, while the pending validation still reads the other set
+    auto referenceClassPointer = referenceClasses.find(kernelId);
+    if (referenceClassPointer != referenceClasses.end())
+    {
+        validations.push_back(std::make_pair(downloadResultArguments(std::get<1>(referenceClassPointer->second)),
+            &referenceClassResults.find(kernelId)->second));
+    }
+
+    auto referenceKernelPointer = referenceKernels.find(kernelId);
+    if (referenceKernelPointer != referenceKernels.end())
+    {
+        validations.push_back(std::make_pair(downloadResultArguments(std::get<2>(referenceKernelPointer->second)),
+            &referenceKernelResults.find(kernelId)->second));
+    }
+
+    if (validations.empty())
+    {
+        return false;
+    }
+
+    waitForPendingValidation();
+    const std::string kernelName = kernel.getName();
+
+    pendingResult = result;
+    pendingValidation = validationPool.enqueue([this, validations, kernelName]()
+    {
+        for (const auto& validation : validations)
+        {
+            if (!validateArguments(validation.first, *validation.second, kernelName))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    });
+
+    activeResultBuffers = 1 - activeResultBuffers;
+    return true;
+}
+
+void ResultValidator::waitForPendingValidation()
+{
+    if (!pendingValidation.valid())
+    {
+        return;
+    }
+
+    bool validationResult;
 
-    for (const auto argumentId : argumentIds)
+    try
     {
-        resultArguments.emplace_back(kernelRunner->downloadArgument(argumentId));
+        validationResult = pendingValidation.get();
     }
+    catch (const std::runtime_error& error)
+    {
+        Logger::logWarning(std::string("Result validation failed, reason: ") + error.what());
+        validationResult = false;
+    }
+
+    completedValidations.push_back(std::make_pair(pendingResult, validationResult));
+}
 
-    return validateArguments(resultArguments, referenceKernelResults.find(kernelId)->second, kernel.getName());
+std::vector<std::pair<KernelResult, bool>> ResultValidator::retrieveCompletedValidations()
+{
+    std::vector<std::pair<KernelResult, bool>> validations;
+    validations.swap(completedValidations);
+    return validations;
 }
 
 double ResultValidator::getToleranceThreshold() const
@@ -170,6 +269,44 @@ bool ResultValidator::hasReferenceResult(const KernelId id) const
     return false;
 }
 
+bool ResultValidator::isValidationPending(const std::string& kernelName, const std::vector<ParameterPair>& configuration) const
+{
+    return pendingValidation.valid() && pendingResult.getKernelName() == kernelName
+        && ResultPrinter::hasEqualParameterPairs(pendingResult.getConfiguration().getParameterPairs(), configuration);
+}
+
+const KernelArgument* ResultValidator::downloadResultArgument(const ArgumentId id)
+{
+    const KernelArgument& argument = argumentManager->getArgument(id);
+    const size_t numberOfElements = kernelRunner->getArgumentBufferSize(id) / argument.getElementSizeInBytes();
+    auto& buffers = resultBuffers[activeResultBuffers];
+    auto resultPointer = buffers.find(id);
+
+    // Result buffers are reused for subsequent configurations, they are only reallocated if size of the argument buffer changes
+    if (resultPointer == buffers.end() || resultPointer->second.getNumberOfElements() != numberOfElements)
+    {
+        buffers.erase(id);
+        resultPointer = buffers.insert(std::make_pair(id, KernelArgument(id, numberOfElements, argument.getElementSizeInBytes(),
+            argument.getDataType(), argument.getMemoryLocation(), argument.getAccessType(), ArgumentUploadType::Vector))).first;
+    }
+
+    KernelArgument& result = resultPointer->second;
+    kernelRunner->downloadArgument(id, result.getData(), result.getDataSizeInBytes());
+    return &result;
+}
+
+std::vector<const KernelArgument*> ResultValidator::downloadResultArguments(const std::vector<ArgumentId>& ids)
+{
+    std::vector<const KernelArgument*> results;
+
+    for (const auto id : ids)
+    {
+        results.push_back(downloadResultArgument(id));
+    }
+
+    return results;
+}
+
 void ResultValidator::computeReferenceResultWithClass(const Kernel& kernel)
 {
     KernelId kernelId = kernel.getId();
@@ -264,8 +401,8 @@ void ResultValidator::computeReferenceResultWithKernel(const Kernel& kernel)
     referenceKernelResults.insert(std::make_pair(kernelId, referenceResult));
 }
 
-bool ResultValidator::validateArguments(const std::vector<KernelArgument>& resultArguments, const std::vector<KernelArgument>& referenceArguments,
-    const std::string kernelName) const
+bool ResultValidator::validateArguments(const std::vector<const KernelArgument*>& resultArguments,
+    const std::vector<KernelArgument>& referenceArguments, const std::string kernelName) const
 {
     bool validationResult = true;
 
@@ -273,19 +410,19 @@ bool ResultValidator::validateArguments(const std::vector<KernelArgument>& resul
     {
         bool argumentValidated = false;
 
-        for (const auto& resultArgument : resultArguments)
+        for (const auto resultArgument : resultArguments)
         {
-            if (resultArgument.getId() != referenceArgument.getId())
+            if (resultArgument->getId() != referenceArgument.getId())
             {
                 continue;
             }
 
             ArgumentDataType referenceDataType = referenceArgument.getDataType();
-            ArgumentId id = resultArgument.getId();
-            if (referenceDataType != resultArgument.getDataType())
+            ArgumentId id = resultArgument->getId();
+            if (referenceDataType != resultArgument->getDataType())
             {
                 Logger::getLogger().log(LoggingLevel::Warning, std::string("Reference class argument data type mismatch for argument id: ")
-                    + std::to_string(resultArgument.getId()));
+                    + std::to_string(resultArgument->getId()));
                 return false;
             }
 
@@ -294,7 +431,7 @@ bool ResultValidator::validateArguments(const std::vector<KernelArgument>& resul
 
             if (comparatorPointer != argumentComparators.end())
             {
-                const size_t resultSize = resultArgument.getNumberOfElements();
+                const size_t resultSize = resultArgument->getNumberOfElements();
                 const size_t referenceSize = referenceArgument.getNumberOfElements();
                 auto argumentRangePointer = argumentValidationRanges.find(id);
 
@@ -316,58 +453,58 @@ bool ResultValidator::validateArguments(const std::vector<KernelArgument>& resul
                             + std::to_string(validationRange));
                     }
 
-                    currentResult = validateResultCustom(id, resultArgument.getData(), referenceArgument.getData(), validationRange,
-                        resultArgument.getElementSizeInBytes(), comparatorPointer->second);
+                    currentResult = validateResultCustom(id, resultArgument->getData(), referenceArgument.getData(), validationRange,
+                        resultArgument->getElementSizeInBytes(), comparatorPointer->second);
                 }
                 else
                 {
-                    currentResult = validateResultCustom(id, resultArgument.getData(), referenceArgument.getData(), resultSize,
-                        resultArgument.getElementSizeInBytes(), comparatorPointer->second);
+                    currentResult = validateResultCustom(id, resultArgument->getData(), referenceArgument.getData(), resultSize,
+                        resultArgument->getElementSizeInBytes(), comparatorPointer->second);
                 }
             }
             else if (referenceDataType == ArgumentDataType::Char)
             {
-                currentResult = validateResult<int8_t>(resultArgument, referenceArgument, id);
+                currentResult = validateResult<int8_t>(*resultArgument, referenceArgument, id);
             }
             else if (referenceDataType == ArgumentDataType::UnsignedChar)
             {
-                currentResult = validateResult<uint8_t>(resultArgument, referenceArgument, id);
+                currentResult = validateResult<uint8_t>(*resultArgument, referenceArgument, id);
             }
             else if (referenceDataType == ArgumentDataType::Short)
             {
-                currentResult = validateResult<int16_t>(resultArgument, referenceArgument, id);
+                currentResult = validateResult<int16_t>(*resultArgument, referenceArgument, id);
             }
             else if (referenceDataType == ArgumentDataType::UnsignedShort)
             {
-                currentResult = validateResult<uint16_t>(resultArgument, referenceArgument, id);
+                currentResult = validateResult<uint16_t>(*resultArgument, referenceArgument, id);
             }
             else if (referenceDataType == ArgumentDataType::Int)
             {
-                currentResult = validateResult<int32_t>(resultArgument, referenceArgument, id);
+                currentResult = validateResult<int32_t>(*resultArgument, referenceArgument, id);
             }
             else if (referenceDataType == ArgumentDataType::UnsignedInt)
             {
-                currentResult = validateResult<uint32_t>(resultArgument, referenceArgument, id);
+                currentResult = validateResult<uint32_t>(*resultArgument, referenceArgument, id);
             }
             else if (referenceDataType == ArgumentDataType::Long)
             {
-                currentResult = validateResult<int64_t>(resultArgument, referenceArgument, id);
+                currentResult = validateResult<int64_t>(*resultArgument, referenceArgument, id);
             }
             else if (referenceDataType == ArgumentDataType::UnsignedLong)
             {
-                currentResult = validateResult<uint64_t>(resultArgument, referenceArgument, id);
+                currentResult = validateResult<uint64_t>(*resultArgument, referenceArgument, id);
             }
             else if (referenceDataType == ArgumentDataType::Half)
             {
-                currentResult = validateResult<half>(resultArgument, referenceArgument, id);
+                currentResult = validateResult<half>(*resultArgument, referenceArgument, id);
             }
             else if (referenceDataType == ArgumentDataType::Float)
             {
-                currentResult = validateResult<float>(resultArgument, referenceArgument, id);
+                currentResult = validateResult<float>(*resultArgument, referenceArgument, id);
             }
             else if (referenceDataType == ArgumentDataType::Double)
             {
-                currentResult = validateResult<double>(resultArgument, referenceArgument, id);
+                currentResult = validateResult<double>(*resultArgument, referenceArgument, id);
             }
             else if (referenceDataType == ArgumentDataType::Custom)
             {
@@ -426,4 +563,22 @@ bool ResultValidator::isRunModeValidated(const KernelRunMode mode)
     }
 }
 
+std::string ResultValidator::getComparisonSummary(const ComparisonOutcome& outcome, const size_t range) const
+{
+    const ComparisonStatistics& statistics = outcome.statistics;
+    const double elementCount = range == 0 ? 1.0 : static_cast<double>(range);
+    std::string summary = std::string(", maximum ULP distance: ") + std::to_string(statistics.maximumUlpDistance) + ", maximum difference: "
+        + std::to_string(statistics.maximumDifference) + ", root mean square error: "
+        + std::to_string(std::sqrt(statistics.squaredDifferenceSum / elementCount));
+
+    // Only side-by-side methods have per-element tolerance
+    if (validationMethod == ValidationMethod::SideBySideComparison || validationMethod == ValidationMethod::SideBySideUlpComparison)
+    {
+        summary += ", elements within tolerance: " + std::to_string(100.0 * static_cast<double>(statistics.withinToleranceCount) / elementCount)
+            + "%";
+    }
+
+    return summary;
+}
+
 } // namespace ktt
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -11,12 +13,15 @@
 #include <type_traits>
 #include <vector>
 #include <api/reference_class.h>
+#include <dto/kernel_result.h>
 #include <enum/kernel_run_mode.h>
 #include <enum/validation_method.h>
 #include <enum/validation_mode.h>
 #include <kernel/kernel_manager.h>
 #include <kernel_argument/argument_manager.h>
+#include <tuning_runner/comparison/result_comparator.h>
 #include <utility/logger.h>
+#include <utility/thread_pool.h>
 #include <half.hpp>
 
 namespace ktt
@@ -38,6 +43,7 @@ public:
     void setReferenceClass(const KernelId id, std::unique_ptr<ReferenceClass> referenceClass, const std::vector<ArgumentId>& validatedArgumentIds);
     void setToleranceThreshold(const double threshold);
     void setValidationMethod(const ValidationMethod method);
+    void setRelativeValidationFloor(const double floor);
     void setValidationMode(const ValidationMode mode);
     void setValidationRange(const ArgumentId id, const size_t range);
     void setArgumentComparator(const ArgumentId id, const std::function<bool(const void*, const void*)>& comparator);
@@ -47,11 +53,15 @@ public:
     bool validateArguments(const Kernel& kernel, const KernelRunMode runMode);
     bool validateArgumentsWithClass(const Kernel& kernel, const KernelRunMode runMode);
     bool validateArgumentsWithKernel(const Kernel& kernel, const KernelRunMode runMode);
+    bool validateArgumentsAsync(const Kernel& kernel, const KernelRunMode runMode, const KernelResult& result);
+    void waitForPendingValidation();
+    std::vector<std::pair<KernelResult, bool>> retrieveCompletedValidations();
 
     // Getters
     double getToleranceThreshold() const;
     ValidationMethod getValidationMethod() const;
     bool hasReferenceResult(const KernelId id) const;
+    bool isValidationPending(const std::string& kernelName, const std::vector<ParameterPair>& configuration) const;
 
 private:
     // Attributes
@@ -66,15 +76,25 @@ private:
     std::map<KernelId, std::tuple<KernelId, std::vector<ParameterPair>, std::vector<ArgumentId>>> referenceKernels;
     std::map<KernelId, std::vector<KernelArgument>> referenceClassResults;
     std::map<KernelId, std::vector<KernelArgument>> referenceKernelResults;
+    std::array<std::map<ArgumentId, KernelArgument>, 2> resultBuffers;
+    size_t activeResultBuffers;
+    std::future<bool> pendingValidation;
+    KernelResult pendingResult;
+    std::vector<std::pair<KernelResult, bool>> completedValidations;
+    ResultComparator resultComparator;
+    ThreadPool validationPool;
 
     // Helper methods
     void computeReferenceResultWithClass(const Kernel& kernel);
     void computeReferenceResultWithKernel(const Kernel& kernel);
-    bool validateArguments(const std::vector<KernelArgument>& resultArguments, const std::vector<KernelArgument>& referenceArguments,
+    const KernelArgument* downloadResultArgument(const ArgumentId id);
+    std::vector<const KernelArgument*> downloadResultArguments(const std::vector<ArgumentId>& ids);
+    bool validateArguments(const std::vector<const KernelArgument*>& resultArguments, const std::vector<KernelArgument>& referenceArguments,
         const std::string kernelName) const;
     bool validateResultCustom(const ArgumentId id, const void* result, const void* referenceResult, const size_t numberOfElements,
         const size_t elementSizeInBytes, const std::function<bool(const void*, const void*)>& comparator) const;
     bool isRunModeValidated(const KernelRunMode mode);
+    std::string getComparisonSummary(const ComparisonOutcome& outcome, const size_t range) const;
 
     template <typename T>
     bool validateResult(const KernelArgument& resultArgument, const KernelArgument& referenceArgument, const ArgumentId id) const
@@ -107,80 +127,66 @@ private:
             }
         }
 
-        return validateResultInner(result, reference, validationRange, id, std::is_floating_point<T>());
+        // Half precision elements are compared with tolerance as well
+        return validateResultInner(result, reference, validationRange, id,
+            std::integral_constant<bool, std::is_floating_point<T>::value || std::is_same<T, half>::value>());
     }
 
     template <typename T>
     bool validateResultInner(const T* result, const T* reference, const size_t range, const ArgumentId id, std::true_type) const
     {
-        if (validationMethod == ValidationMethod::AbsoluteDifference)
-        {
-            double difference = 0.0;
-
-            for (size_t i = 0; i < range; ++i)
-            {
-                difference += std::fabs(result[i] - reference[i]);
-            }
-
-            if (difference > toleranceThreshold)
-            {
-                Logger::logWarning(std::string("Results differ for argument with id: ") + std::to_string(id) + ", absolute difference is: "
-                    + std::to_string(difference));
-                return false;
-            }
+        const ComparisonOutcome outcome = resultComparator.compare(result, reference, range, validationMethod, toleranceThreshold);
 
+        if (outcome.passed)
+        {
             return true;
         }
-        else if (validationMethod == ValidationMethod::SideBySideComparison)
+
+        if (validationMethod == ValidationMethod::AbsoluteDifference)
         {
-            for (size_t i = 0; i < range; ++i)
-            {
-                if (std::fabs(result[i] - reference[i]) > toleranceThreshold)
-                {
-                    Logger::logWarning(std::string("Results differ for argument with id: ") + std::to_string(id) + ", index: " + std::to_string(i)
-                        + ", reference value: " + std::to_string(reference[i]) + ", result value: " + std::to_string(result[i]) + ", difference: "
-                        + std::to_string(std::fabs(result[i] - reference[i])));
-                    return false;
-                }
-            }
-            return true;
+            Logger::logWarning(std::string("Results differ for argument with id: ") + std::to_string(id) + ", absolute difference is at least: "
+                + std::to_string(outcome.difference) + getComparisonSummary(outcome, range));
+            return false;
         }
-        else if (validationMethod == ValidationMethod::SideBySideRelativeComparison)
+
+        if (validationMethod == ValidationMethod::RootMeanSquareError)
         {
-            for (size_t i = 0; i < range; ++i)
-            {
-                double difference = std::fabs(result[i] - reference[i]);
-
-                if ((difference > 1e-4) && (difference / reference[i] > toleranceThreshold))
-                {
-                    Logger::logWarning(std::string("Results differ for argument with id: ") + std::to_string(id) + ", index: " + std::to_string(i)
-                        + ", reference value: " + std::to_string(reference[i]) + ", result value: " + std::to_string(result[i])
-                        + ", relative difference: " + std::to_string(difference / reference[i]));
-                    return false;
-                }
-            }
-            return true;
+            Logger::logWarning(std::string("Results differ for argument with id: ") + std::to_string(id) + getComparisonSummary(outcome, range));
+            return false;
         }
-        else
+
+        const size_t i = outcome.index;
+        const double difference = std::fabs(static_cast<double>(result[i]) - static_cast<double>(reference[i]));
+
+        if (validationMethod == ValidationMethod::SideBySideRelativeComparison)
         {
-            throw std::runtime_error("Unsupported validation method");
+            Logger::logWarning(std::string("Results differ for argument with id: ") + std::to_string(id) + ", index: " + std::to_string(i)
+                + ", reference value: " + std::to_string(reference[i]) + ", result value: " + std::to_string(result[i])
+                + ", relative difference: " + std::to_string(difference / std::fabs(static_cast<double>(reference[i])))
+                + getComparisonSummary(outcome, range));
+            return false;
         }
+
+        Logger::logWarning(std::string("Results differ for argument with id: ") + std::to_string(id) + ", index: " + std::to_string(i)
+            + ", reference value: " + std::to_string(reference[i]) + ", result value: " + std::to_string(result[i]) + ", difference: "
+            + std::to_string(difference) + getComparisonSummary(outcome, range));
+        return false;
     }
 
     template <typename T>
     bool validateResultInner(const T* result, const T* reference, const size_t range, const ArgumentId id, std::false_type) const
     {
-        for (size_t i = 0; i < range; ++i)
+        const size_t i = resultComparator.findDifference(result, reference, range, sizeof(T));
+
+        if (i == range)
         {
-            if (result[i] != reference[i])
-            {
-                Logger::logWarning(std::string("Results differ for argument with id: ") + std::to_string(id) + ", index: " + std::to_string(i)
-                    + ", reference value: " + std::to_string(reference[i]) + ", result value: " + std::to_string(result[i]) + ", difference: "
-                    + std::to_string(static_cast<T>(std::fabs(result[i] - reference[i]))));
-                return false;
-            }
+            return true;
         }
-        return true;
+
+        Logger::logWarning(std::string("Results differ for argument with id: ") + std::to_string(id) + ", index: " + std::to_string(i)
+            + ", reference value: " + std::to_string(reference[i]) + ", result value: " + std::to_string(result[i]) + ", difference: "
+            + std::to_string(static_cast<T>(std::fabs(result[i] - reference[i]))));
+        return false;
     }
 };
 
@@ -2,10 +2,11 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <limits>
 #include <random>
 #include <stdexcept>
-#include <tuning_runner/searcher/searcher.h>
+#include <api/searcher/searcher.h>
 
 namespace ktt
 {
@@ -16,87 +17,123 @@ public:
     static const size_t maximumAlreadyVisitedStates = 10;
     static const size_t maximumDifferences = 3;
 
-    AnnealingSearcher(const std::vector<KernelConfiguration>& configurations, const double maximumTemperature) :
-        configurations(configurations),
+    AnnealingSearcher(const double maximumTemperature) :
+        index(0),
         maximumTemperature(maximumTemperature),
         visitedStatesCount(0),
         currentState(0),
         neighbourState(0),
-        alreadyVisistedStatesCount(0),
-        executionTimes(configurations.size(), std::numeric_limits<double>::max()),
         generator(static_cast<unsigned int>(std::chrono::system_clock::now().time_since_epoch().count())),
-        intDistribution(0, static_cast<int>(configurations.size()-1)),
         probabilityDistribution(0.0, 1.0)
+    {}
+
+    void onInitialize() override
     {
-        if (configurations.size() == 0)
-        {
-            throw std::runtime_error("Configurations vector provided for searcher is empty");
-        }
+        visitedStatesCount = 0;
+        neighbourState = 0;
+        executionTimes.assign(getConfigurationCount(), std::numeric_limits<double>::max());
+        exploredIndices.clear();
+        intDistribution = std::uniform_int_distribution<int>(0, static_cast<int>(getConfigurationCount() - 1));
+
         size_t initialState = static_cast<size_t>(intDistribution(generator));
         currentState = initialState;
         index = initialState;
     }
 
-    void calculateNextConfiguration(const KernelResult& previousResult) override
+    void onReset() override
     {
-        if (previousResult.getComputationDuration() > 0) // workaround for recursive calls
-        {
-            visitedStatesCount++;
-            exploredIndices.push_back(currentState);
-            executionTimes.at(index) = static_cast<double>(previousResult.getComputationDuration());
-        }
-        
-        double progress = visitedStatesCount / static_cast<double>(configurations.size());
-        double temperature = maximumTemperature * (1.0 - progress);
+        executionTimes.clear();
+        exploredIndices.clear();
+    }
 
-        double acceptanceProbability = getAcceptanceProbability(executionTimes.at(currentState), executionTimes.at(neighbourState), temperature);
-        double randomProbability = probabilityDistribution(generator);
-        if (acceptanceProbability > randomProbability)
-        {
-            currentState = neighbourState;
-        }
+    void calculateNextConfiguration(const ComputationResult& previousResult) override
+    {
+        visitedStatesCount++;
+        exploredIndices.push_back(currentState);
+        executionTimes.at(index) = previousResult.getObjectiveValue();
 
-        std::vector<size_t> neighbours = getNeighbours(currentState);
-        neighbourState = neighbours.at(static_cast<size_t>(intDistribution(generator)) % neighbours.size());
+        size_t alreadyVisitedStatesCount = 0;
 
-        if (executionTimes.at(neighbourState) != std::numeric_limits<double>::max())
+        while (true)
         {
-            if (alreadyVisistedStatesCount < maximumAlreadyVisitedStates)
+            double progress = visitedStatesCount / static_cast<double>(getConfigurationCount());
+            double temperature = maximumTemperature * (1.0 - progress);
+
+            double acceptanceProbability = getAcceptanceProbability(executionTimes.at(currentState), executionTimes.at(neighbourState), temperature);
+            double randomProbability = probabilityDistribution(generator);
+            if (acceptanceProbability > randomProbability)
+            {
+                currentState = neighbourState;
+            }
+
+            std::vector<size_t> neighbours = getNeighbours(currentState);
+            neighbourState = neighbours.at(static_cast<size_t>(intDistribution(generator)) % neighbours.size());
+
+            if (executionTimes.at(neighbourState) == std::numeric_limits<double>::max()
+                || alreadyVisitedStatesCount >= maximumAlreadyVisitedStates)
             {
-                alreadyVisistedStatesCount++;
-                KernelResult result = previousResult;
-                result.setComputationDuration(0);
-                calculateNextConfiguration(result);
-                return;
+                break;
             }
+
+            alreadyVisitedStatesCount++;
         }
-        alreadyVisistedStatesCount = 0;
+
         index = neighbourState;
     }
 
-    KernelConfiguration getNextConfiguration() const override
+    size_t getNextConfigurationIndex() const override
     {
-        return configurations.at(index);
+        return index;
     }
 
     size_t getUnexploredConfigurationCount() const override
     {
-        if (visitedStatesCount >= configurations.size())
+        if (visitedStatesCount >= getConfigurationCount())
         {
             return 0;
         }
 
-        return configurations.size() - visitedStatesCount;
+        return getConfigurationCount() - visitedStatesCount;
+    }
+
+    std::vector<size_t> getLikelyConfigurationIndices(const size_t count) const override
+    {
+        // Next state is a neighbour of either current state or tested state, depending on whether the tested state gets accepted
+        const std::vector<size_t> currentNeighbours = getNeighbours(currentState);
+        const std::vector<size_t> testedNeighbours = getNeighbours(index);
+        std::vector<size_t> result;
+
+        // Neighbours of both states can be chosen regardless of acceptance, so they are ranked first
+        for (const auto neighbour : testedNeighbours)
+        {
+            if (result.size() < count && isUnexplored(neighbour)
+                && std::binary_search(currentNeighbours.cbegin(), currentNeighbours.cend(), neighbour))
+            {
+                result.push_back(neighbour);
+            }
+        }
+
+        for (size_t i = 0; i < std::max(testedNeighbours.size(), currentNeighbours.size()) && result.size() < count; ++i)
+        {
+            for (const auto* neighbours : {&testedNeighbours, &currentNeighbours})
+            {
+                if (i < neighbours->size() && result.size() < count && isUnexplored(neighbours->at(i))
+                    && std::find(result.cbegin(), result.cend(), neighbours->at(i)) == result.cend())
+                {
+                    result.push_back(neighbours->at(i));
+                }
+            }
+        }
+
+        return result;
     }
 
 private:
-    const std::vector<KernelConfiguration>& configurations;
     size_t index;
     double maximumTemperature;
     size_t visitedStatesCount;
     size_t currentState;
     size_t neighbourState;
-    size_t alreadyVisistedStatesCount;
 
     std::vector<double> executionTimes;
     std::vector<size_t> exploredIndices;
@@ -106,17 +143,23 @@ private:
     std::uniform_real_distribution<double> probabilityDistribution;
 
     // Helper methods
+    bool isUnexplored(const size_t state) const
+    {
+        return state != index && executionTimes.at(state) == std::numeric_limits<double>::max();
+    }
+
     std::vector<size_t> getNeighbours(const size_t referenceId) const
     {
         std::vector<size_t> neighbours;
-        size_t otherId = 0;
-        for (const auto& configuration : configurations)
+        const std::vector<ParameterPair>& referencePairs = getConfiguration(referenceId);
+
+        for (size_t otherId = 0; otherId < getConfigurationCount(); ++otherId)
         {
             size_t differences = 0;
             size_t settingId = 0;
-            for (const auto& parameter : configuration.getParameterPairs())
+            for (const auto& parameter : getConfiguration(otherId))
             {
-                if (parameter.getValue() != configurations.at(referenceId).getParameterPairs().at(settingId).getValue())
+                if (parameter.getValue() != referencePairs.at(settingId).getValue())
                 {
                     differences++;
                 }
@@ -127,7 +170,6 @@ private:
             {
                 neighbours.push_back(otherId);
             }
-            otherId++;
         }
 
         if (neighbours.size() == 0)
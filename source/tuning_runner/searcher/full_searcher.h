@@ -1,6 +1,6 @@
 #pragma once
 
-#include <tuning_runner/searcher/searcher.h>
+#include <api/searcher/searcher.h>
 
 namespace ktt
 {
@@ -8,38 +8,48 @@ namespace ktt
 class FullSearcher : public Searcher
 {
 public:
-    FullSearcher(const std::vector<KernelConfiguration>& configurations) :
-        configurations(configurations),
+    FullSearcher() :
         index(0)
+    {}
+
+    void onInitialize() override
     {
-        if (configurations.size() == 0)
-        {
-            throw std::runtime_error("Configurations vector provided for searcher is empty");
-        }
+        index = 0;
     }
 
-    void calculateNextConfiguration(const KernelResult&) override
+    void calculateNextConfiguration(const ComputationResult&) override
     {
         index++;
     }
 
-    KernelConfiguration getNextConfiguration() const override
+    size_t getNextConfigurationIndex() const override
     {
-        return configurations.at(index);
+        return index;
     }
 
     size_t getUnexploredConfigurationCount() const override
     {
-        if (index >= configurations.size())
+        if (index >= getConfigurationCount())
         {
             return 0;
         }
 
-        return configurations.size() - index;
+        return getConfigurationCount() - index;
+    }
+
+    std::vector<size_t> getUpcomingConfigurationIndices(const size_t count) const override
+    {
+        std::vector<size_t> result;
+
+        for (size_t i = index + 1; i < getConfigurationCount() && result.size() < count; i++)
+        {
+            result.push_back(i);
+        }
+
+        return result;
     }
 
 private:
-    const std::vector<KernelConfiguration>& configurations;
     size_t index;
 };
 
@@ -7,7 +7,8 @@
 #include <set>
 #include <sstream>
 #include <stdexcept>
-#include <tuning_runner/searcher/searcher.h>
+#include <vector>
+#include <api/searcher/searcher.h>
 #include <utility/logger.h>
 
 namespace ktt
@@ -20,43 +21,59 @@ public:
     static const size_t bootIterations = 10;
     const double escapeProbability = 0.02;
 
-    MCMCSearcher(const std::vector<KernelConfiguration>& configurations, const std::vector<double>& start) :
-        configurations(configurations),
+    MCMCSearcher(const std::vector<double>& start) :
+        index(0),
         visitedStatesCount(0),
         originState(0),
         currentState(0),
-        executionTimes(configurations.size(), std::numeric_limits<double>::max()),
-        exploredIndices(configurations.size(), false),
+        boot(0),
+        start(start),
         generator(static_cast<unsigned int>(std::chrono::system_clock::now().time_since_epoch().count())),
-        intDistribution(0, static_cast<int>(configurations.size()-1)),
         probabilityDistribution(0.0, 1.0),
         bestTime(std::numeric_limits<double>::max())
+    {}
+
+    void onInitialize() override
     {
-        if (configurations.size() == 0)
-        {
-            throw std::runtime_error("Configurations vector provided for searcher is empty");
-        }
+        const size_t configurationCount = getConfigurationCount();
+        visitedStatesCount = 0;
+        executionTimes.assign(configurationCount, std::numeric_limits<double>::max());
+        exploredIndices.assign(configurationCount, false);
+        intDistribution = std::uniform_int_distribution<int>(0, static_cast<int>(configurationCount - 1));
+        bestTime = std::numeric_limits<double>::max();
 
         size_t initialState;
-        if (start.size() > 0) 
+        if (start.size() > 0)
+        {
             initialState = searchStateIndex(start);
-        else {
+            boot = 0;
+        }
+        else
+        {
             initialState = static_cast<size_t>(intDistribution(generator));
             boot = bootIterations;
         }
         originState = currentState = initialState;
         index = initialState;
 
-        for (size_t i = 0; i < configurations.size(); i++)
+        unexploredIndices.clear();
+        for (size_t i = 0; i < configurationCount; i++)
             unexploredIndices.insert(i);
     }
 
-    void calculateNextConfiguration(const KernelResult& previousResult) override
+    void onReset() override
+    {
+        executionTimes.clear();
+        exploredIndices.clear();
+        unexploredIndices.clear();
+    }
+
+    void calculateNextConfiguration(const ComputationResult& previousResult) override
     {
         visitedStatesCount++;
         exploredIndices[index] = true;
         unexploredIndices.erase(index);
-        executionTimes.at(index) = static_cast<double>(previousResult.getComputationDuration());
+        executionTimes.at(index) = previousResult.getObjectiveValue();
 
         // boot-up, sweeps randomly across bootIterations states and sets
         // origin of MCMC to the best state
@@ -144,29 +161,68 @@ public:
         index = currentState;
     }
 
-    KernelConfiguration getNextConfiguration() const override
+    size_t getNextConfigurationIndex() const override
     {
-        return configurations.at(index);
+        return index;
     }
 
     size_t getUnexploredConfigurationCount() const override
     {
-        if (visitedStatesCount >= configurations.size())
+        if (visitedStatesCount >= getConfigurationCount())
         {
             return 0;
         }
 
-        return configurations.size() - visitedStatesCount;
+        return getConfigurationCount() - visitedStatesCount;
+    }
+
+    std::vector<size_t> getLikelyConfigurationIndices(const size_t count) const override
+    {
+        std::vector<size_t> result;
+
+        // States are chosen randomly during boot-up
+        if (boot > 0)
+        {
+            return result;
+        }
+
+        // Next state is a neighbour of either origin or tested state, depending on whether the tested state gets accepted
+        const std::vector<size_t> originNeighbours = getNeighbours(originState);
+        const std::vector<size_t> testedNeighbours = getNeighbours(index);
+
+        // Neighbours of both states can be chosen regardless of acceptance, so they are ranked first
+        for (const auto neighbour : testedNeighbours)
+        {
+            if (result.size() < count && neighbour != index
+                && std::binary_search(originNeighbours.cbegin(), originNeighbours.cend(), neighbour))
+            {
+                result.push_back(neighbour);
+            }
+        }
+
+        for (size_t i = 0; i < std::max(testedNeighbours.size(), originNeighbours.size()) && result.size() < count; ++i)
+        {
+            for (const auto* neighbours : {&testedNeighbours, &originNeighbours})
+            {
+                if (i < neighbours->size() && result.size() < count && neighbours->at(i) != index
+                    && std::find(result.cbegin(), result.cend(), neighbours->at(i)) == result.cend())
+                {
+                    result.push_back(neighbours->at(i));
+                }
+            }
+        }
+
+        return result;
     }
 
 private:
-    const std::vector<KernelConfiguration>& configurations;
     size_t index;
 
     size_t visitedStatesCount;
     size_t originState;
     size_t currentState;
     size_t boot;
+    std::vector<double> start;
 
     std::vector<double> executionTimes;
     std::vector<bool> exploredIndices;
@@ -190,9 +246,9 @@ private:
         {
             size_t differences = 0;
             size_t settingId = 0;
-            for (const auto& parameter : configurations[i].getParameterPairs())
+            for (const auto& parameter : getConfiguration(i))
             {
-                if (parameter.getValue() != configurations.at(referenceId).getParameterPairs().at(settingId).getValue())
+                if (parameter.getValue() != getConfiguration(referenceId).at(settingId).getValue())
                 {
                     differences++;
                 }
@@ -244,11 +300,11 @@ private:
     size_t searchStateIndex(const std::vector<double> &state) {
         size_t states = state.size();
         size_t ret = 0;
-        bool match;
-        for (const auto& configuration : configurations) {
+        bool match = false;
+        for (size_t configurationIndex = 0; configurationIndex < getConfigurationCount(); configurationIndex++) {
             match = true;
             for (size_t i = 0; i < states; i++) {
-                if (configuration.getParameterPairs().at(i).getValue() != state[i]) {
+                if (getConfiguration(configurationIndex).at(i).getValue() != state[i]) {
                     match = false;
                     break;
                 }
@@ -2,7 +2,7 @@
 
 #include <algorithm>
 #include <random>
-#include <tuning_runner/searcher/searcher.h>
+#include <api/searcher/searcher.h>
 
 namespace ktt
 {
@@ -10,17 +10,16 @@ namespace ktt
 class RandomSearcher : public Searcher
 {
 public:
-    RandomSearcher(const std::vector<KernelConfiguration>& configurations) :
-        configurations(configurations),
-        configurationIndices(configurations.size()),
+    RandomSearcher() :
         index(0)
+    {}
+
+    void onInitialize() override
     {
-        if (configurations.size() == 0)
-        {
-            throw std::runtime_error("Configurations vector provided for searcher is empty");
-        }
+        index = 0;
+        configurationIndices.resize(getConfigurationCount());
 
-        for (size_t i = 0; i < configurations.size(); i++)
+        for (size_t i = 0; i < configurationIndices.size(); i++)
         {
             configurationIndices.at(i) = i;
         }
@@ -30,29 +29,44 @@ public:
         std::shuffle(std::begin(this->configurationIndices), std::end(this->configurationIndices), engine);
     }
 
-    void calculateNextConfiguration(const KernelResult&) override
+    void onReset() override
+    {
+        configurationIndices.clear();
+    }
+
+    void calculateNextConfiguration(const ComputationResult&) override
     {
         index++;
     }
 
-    KernelConfiguration getNextConfiguration() const override
+    size_t getNextConfigurationIndex() const override
     {
-        size_t currentIndex = configurationIndices.at(index);
-        return configurations.at(currentIndex);
+        return configurationIndices.at(index);
     }
 
     size_t getUnexploredConfigurationCount() const override
     {
-        if (index >= configurations.size())
+        if (index >= configurationIndices.size())
         {
             return 0;
         }
 
-        return configurations.size() - index;
+        return configurationIndices.size() - index;
+    }
+
+    std::vector<size_t> getUpcomingConfigurationIndices(const size_t count) const override
+    {
+        std::vector<size_t> result;
+
+        for (size_t i = index + 1; i < configurationIndices.size() && result.size() < count; i++)
+        {
+            result.push_back(configurationIndices.at(i));
+        }
+
+        return result;
     }
 
 private:
-    const std::vector<KernelConfiguration>& configurations;
     std::vector<size_t> configurationIndices;
     size_t index;
 };
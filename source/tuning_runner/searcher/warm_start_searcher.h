@@ -0,0 +1,324 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <api/searcher/searcher.h>
+#include <utility/ktt_utility.h>
+
+namespace ktt
+{
+
+// Configurations are indexed by values of their parameters, all configurations of a searcher contain the same parameters in the same order.
+// Unexplored configurations are kept in buckets ordered by distance from the best configuration and from the seeds, so that the next
+// configuration is found in amortized constant time. Buckets are only rebuilt when the best configuration changes.
+class WarmStartSearcher : public Searcher
+{
+public:
+    WarmStartSearcher(const std::vector<std::vector<ParameterPair>>& seedConfigurations) :
+        seedConfigurations(seedConfigurations),
+        index(0),
+        exploredCount(0),
+        seedPosition(0),
+        bestIndex(std::numeric_limits<size_t>::max()),
+        parameterCount(0),
+        orderValid(false),
+        firstOrderBucket(0)
+    {}
+
+    void onInitialize() override
+    {
+        exploredCount = 0;
+        seedPosition = 0;
+        bestIndex = std::numeric_limits<size_t>::max();
+        orderValid = false;
+        explored.assign(getConfigurationCount(), false);
+        executionTimes.assign(getConfigurationCount(), std::numeric_limits<double>::max());
+        seedIndices.clear();
+        seedDistances.assign(getConfigurationCount(), std::numeric_limits<size_t>::max());
+
+        initializeValueIndex();
+
+        // Seeds are projected onto current configuration space, which may differ from the one results were loaded from
+        for (const auto& seed : seedConfigurations)
+        {
+            const size_t nearestIndex = computeSeedDistances(seed);
+
+            if (nearestIndex < getConfigurationCount() && !containsElement(seedIndices, nearestIndex))
+            {
+                seedIndices.push_back(nearestIndex);
+            }
+        }
+
+        index = seedIndices.empty() ? 0 : seedIndices[0];
+    }
+
+    void onReset() override
+    {
+        explored.clear();
+        executionTimes.clear();
+        seedIndices.clear();
+        seedDistances.clear();
+        parameterValues.clear();
+        valueCodes.clear();
+        valueBuckets.clear();
+        matchCounts.clear();
+        orderBuckets.clear();
+        orderCursors.clear();
+        orderValid = false;
+    }
+
+    void calculateNextConfiguration(const ComputationResult& previousResult) override
+    {
+        if (!explored.at(index))
+        {
+            explored[index] = true;
+            exploredCount++;
+        }
+
+        if (previousResult.getObjectiveValue() < std::numeric_limits<double>::max())
+        {
+            executionTimes[index] = previousResult.getObjectiveValue();
+            if (bestIndex == std::numeric_limits<size_t>::max() || executionTimes[index] < executionTimes[bestIndex])
+            {
+                bestIndex = index;
+                orderValid = false;
+            }
+        }
+
+        if (exploredCount >= getConfigurationCount())
+        {
+            return;
+        }
+
+        // Measure seeds from previous results first
+        while (seedPosition < seedIndices.size())
+        {
+            const size_t seedIndex = seedIndices[seedPosition];
+            seedPosition++;
+
+            if (!explored[seedIndex])
+            {
+                index = seedIndex;
+                return;
+            }
+        }
+
+        // Afterwards, explore neighbourhood of the best configuration measured so far, ties are broken by distance from seeds
+        if (!orderValid)
+        {
+            rebuildOrder();
+        }
+
+        index = getNextOrderedIndex();
+    }
+
+    size_t getNextConfigurationIndex() const override
+    {
+        return index;
+    }
+
+    size_t getUnexploredConfigurationCount() const override
+    {
+        if (exploredCount >= getConfigurationCount())
+        {
+            return 0;
+        }
+
+        return getConfigurationCount() - exploredCount;
+    }
+
+private:
+    std::vector<std::vector<ParameterPair>> seedConfigurations;
+    size_t index;
+    size_t exploredCount;
+    size_t seedPosition;
+    size_t bestIndex;
+    std::vector<bool> explored;
+    std::vector<double> executionTimes;
+    std::vector<size_t> seedIndices;
+    std::vector<size_t> seedDistances;
+
+    // Value index, codes of configuration values are stored in row-major order
+    size_t parameterCount;
+    std::vector<std::vector<ParameterPair>> parameterValues;
+    std::vector<size_t> valueCodes;
+    std::vector<std::vector<std::vector<size_t>>> valueBuckets;
+    std::vector<size_t> matchCounts;
+
+    // Unexplored configurations ordered by distance from the best configuration and from the seeds
+    bool orderValid;
+    size_t firstOrderBucket;
+    std::vector<std::vector<size_t>> orderBuckets;
+    std::vector<size_t> orderCursors;
+
+    // Helper methods
+    void initializeValueIndex()
+    {
+        const size_t configurationCount = getConfigurationCount();
+        parameterCount = configurationCount == 0 ? 0 : getConfiguration(0).size();
+        parameterValues.assign(parameterCount, std::vector<ParameterPair>{});
+        valueBuckets.assign(parameterCount, std::vector<std::vector<size_t>>{});
+        valueCodes.assign(configurationCount * parameterCount, 0);
+        matchCounts.assign(configurationCount, 0);
+
+        for (size_t i = 0; i < configurationCount; i++)
+        {
+            const std::vector<ParameterPair>& configuration = getConfiguration(i);
+
+            for (size_t parameter = 0; parameter < parameterCount; parameter++)
+            {
+                const size_t code = getValueCode(parameter, configuration.at(parameter), true);
+                valueCodes[i * parameterCount + parameter] = code;
+                valueBuckets[parameter][code].push_back(i);
+            }
+        }
+    }
+
+    size_t getValueCode(const size_t parameter, const ParameterPair& pair, const bool addMissing)
+    {
+        std::vector<ParameterPair>& values = parameterValues[parameter];
+
+        for (size_t code = 0; code < values.size(); code++)
+        {
+            if (valuesEqual(values[code], pair))
+            {
+                return code;
+            }
+        }
+
+        if (!addMissing)
+        {
+            return std::numeric_limits<size_t>::max();
+        }
+
+        values.push_back(pair);
+        valueBuckets[parameter].emplace_back();
+        return values.size() - 1;
+    }
+
+    // Adds number of matching values with the specified code to each configuration which contains it, configurations are reached through
+    // value buckets, so configurations which do not match any value are never visited
+    void countMatches(const size_t parameter, const size_t code)
+    {
+        if (code >= valueBuckets[parameter].size())
+        {
+            return;
+        }
+
+        for (const size_t configuration : valueBuckets[parameter][code])
+        {
+            matchCounts[configuration]++;
+        }
+    }
+
+    // Parameters which are not present in seed do not contribute to distance, returns index of the nearest configuration
+    size_t computeSeedDistances(const std::vector<ParameterPair>& seed)
+    {
+        std::fill(matchCounts.begin(), matchCounts.end(), 0);
+        size_t presentCount = 0;
+
+        for (size_t parameter = 0; parameter < parameterCount; parameter++)
+        {
+            const std::string& name = getConfiguration(0)[parameter].getName();
+
+            for (const auto& seedPair : seed)
+            {
+                if (seedPair.getName() == name)
+                {
+                    presentCount++;
+                    countMatches(parameter, getValueCode(parameter, seedPair, false));
+                    break;
+                }
+            }
+        }
+
+        size_t nearestIndex = std::numeric_limits<size_t>::max();
+        size_t nearestDistance = std::numeric_limits<size_t>::max();
+
+        for (size_t i = 0; i < getConfigurationCount(); i++)
+        {
+            const size_t distance = presentCount - matchCounts[i];
+
+            if (distance < nearestDistance)
+            {
+                nearestDistance = distance;
+                nearestIndex = i;
+            }
+
+            seedDistances[i] = std::min(seedDistances[i], distance);
+        }
+
+        return nearestIndex;
+    }
+
+    void rebuildOrder()
+    {
+        std::fill(matchCounts.begin(), matchCounts.end(), 0);
+        const bool bestFound = bestIndex != std::numeric_limits<size_t>::max();
+
+        if (bestFound)
+        {
+            for (size_t parameter = 0; parameter < parameterCount; parameter++)
+            {
+                countMatches(parameter, valueCodes[bestIndex * parameterCount + parameter]);
+            }
+        }
+
+        // Seed distances never exceed number of parameters, configurations without seeds are placed after all seeded ones
+        const size_t seedDistanceCount = parameterCount + 2;
+        orderBuckets.assign((parameterCount + 1) * seedDistanceCount, std::vector<size_t>{});
+        orderCursors.assign(orderBuckets.size(), 0);
+        firstOrderBucket = 0;
+
+        for (size_t i = 0; i < getConfigurationCount(); i++)
+        {
+            if (explored[i])
+            {
+                continue;
+            }
+
+            const size_t bestDistance = bestFound ? parameterCount - matchCounts[i] : 0;
+            const size_t seedDistance = std::min(seedDistances[i], parameterCount + 1);
+            orderBuckets[bestDistance * seedDistanceCount + seedDistance].push_back(i);
+        }
+
+        orderValid = true;
+    }
+
+    // Explored configurations are skipped lazily, buckets before the first non-empty one never receive new configurations until rebuild
+    size_t getNextOrderedIndex()
+    {
+        for (; firstOrderBucket < orderBuckets.size(); firstOrderBucket++)
+        {
+            const std::vector<size_t>& bucket = orderBuckets[firstOrderBucket];
+            size_t& cursor = orderCursors[firstOrderBucket];
+
+            while (cursor < bucket.size() && explored[bucket[cursor]])
+            {
+                cursor++;
+            }
+
+            if (cursor < bucket.size())
+            {
+                return bucket[cursor];
+            }
+        }
+
+        throw std::runtime_error("Warm start searcher could not find any unexplored configuration");
+    }
+
+    static bool valuesEqual(const ParameterPair& first, const ParameterPair& second)
+    {
+        if (first.hasValueDouble() || second.hasValueDouble())
+        {
+            return floatEquals(first.getValueDouble(), second.getValueDouble());
+        }
+
+        return first.getValue() == second.getValue();
+    }
+};
+
+} // namespace ktt
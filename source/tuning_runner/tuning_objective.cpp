@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <stdexcept>
+#include <tuning_runner/tuning_objective.h>
+
+namespace ktt
+{
+
+TuningObjective::TuningObjective(const ObjectiveMetric metric, const double weight, const double limit) :
+    TuningObjective(getMetricName(metric), getMetricFunction(metric), weight, limit)
+{}
+
+TuningObjective::TuningObjective(const std::string& name, const std::function<double(const ComputationResult&)>& metric, const double weight,
+    const double limit) :
+    name(name),
+    metric(metric),
+    weight(weight),
+    limit(limit)
+{
+    if (!metric)
+    {
+        throw std::runtime_error(std::string("Metric function for the following tuning objective is empty: ") + name);
+    }
+
+    if (weight < 0.0)
+    {
+        throw std::runtime_error(std::string("Weight of the following tuning objective is negative: ") + name);
+    }
+}
+
+double TuningObjective::evaluate(const ComputationResult& result) const
+{
+    return metric(result);
+}
+
+const std::string& TuningObjective::getName() const
+{
+    return name;
+}
+
+double TuningObjective::getWeight() const
+{
+    return weight;
+}
+
+double TuningObjective::getLimit() const
+{
+    return limit;
+}
+
+std::string TuningObjective::getMetricName(const ObjectiveMetric metric)
+{
+    switch (metric)
+    {
+    case ObjectiveMetric::Duration:
+        return "Duration";
+    case ObjectiveMetric::LocalMemory:
+        return "Local memory";
+    case ObjectiveMetric::PrivateMemory:
+        return "Private memory";
+    case ObjectiveMetric::Registers:
+        return "Registers";
+    default:
+        throw std::runtime_error("Unknown objective metric");
+    }
+}
+
+std::function<double(const ComputationResult&)> TuningObjective::getMetricFunction(const ObjectiveMetric metric)
+{
+    switch (metric)
+    {
+    case ObjectiveMetric::Duration:
+        return [](const ComputationResult& result) { return static_cast<double>(result.getDuration()); };
+    case ObjectiveMetric::LocalMemory:
+        return [](const ComputationResult& result)
+        {
+            return getCompilationDataValue(result, [](const KernelCompilationData& data) { return data.localMemorySize; });
+        };
+    case ObjectiveMetric::PrivateMemory:
+        return [](const ComputationResult& result)
+        {
+            return getCompilationDataValue(result, [](const KernelCompilationData& data) { return data.privateMemorySize; });
+        };
+    case ObjectiveMetric::Registers:
+        return [](const ComputationResult& result)
+        {
+            return getCompilationDataValue(result, [](const KernelCompilationData& data) { return data.registersCount; });
+        };
+    default:
+        throw std::runtime_error("Unknown objective metric");
+    }
+}
+
+double TuningObjective::getCompilationDataValue(const ComputationResult& result,
+    const std::function<uint64_t(const KernelCompilationData&)>& value)
+{
+    if (result.getCompositionCompilationData().empty())
+    {
+        return static_cast<double>(value(result.getCompilationData()));
+    }
+
+    uint64_t maximum = 0;
+    for (const auto& data : result.getCompositionCompilationData())
+    {
+        maximum = std::max(maximum, value(data.second));
+    }
+
+    return static_cast<double>(maximum);
+}
+
+} // namespace ktt
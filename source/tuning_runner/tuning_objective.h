@@ -0,0 +1,35 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <api/computation_result.h>
+#include <enum/objective_metric.h>
+
+namespace ktt
+{
+
+class TuningObjective
+{
+public:
+    explicit TuningObjective(const ObjectiveMetric metric, const double weight, const double limit);
+    explicit TuningObjective(const std::string& name, const std::function<double(const ComputationResult&)>& metric, const double weight,
+        const double limit);
+
+    double evaluate(const ComputationResult& result) const;
+
+    const std::string& getName() const;
+    double getWeight() const;
+    double getLimit() const;
+
+private:
+    std::string name;
+    std::function<double(const ComputationResult&)> metric;
+    double weight;
+    double limit;
+
+    static std::string getMetricName(const ObjectiveMetric metric);
+    static std::function<double(const ComputationResult&)> getMetricFunction(const ObjectiveMetric metric);
+    static double getCompilationDataValue(const ComputationResult& result, const std::function<uint64_t(const KernelCompilationData&)>& value);
+};
+
+} // namespace ktt
@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <fstream>
 #include <iterator>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <tuning_runner/tuning_runner.h>
@@ -16,7 +17,12 @@ TuningRunner::TuningRunner(ArgumentManager* argumentManager, KernelManager* kern
     argumentManager(argumentManager),
     kernelManager(kernelManager),
     kernelRunner(kernelRunner),
-    configurationManager(info)
+    configurationManager(info),
+    finalistCount(0),
+    finalistRounds(0),
+    compilationLookahead(0),
+    speculativeCandidateCount(0),
+    asynchronousValidationFlag(false)
 {}
 
 std::vector<ComputationResult> TuningRunner::tuneKernel(const KernelId id, std::unique_ptr<StopCondition> stopCondition)
@@ -40,6 +46,8 @@ std::vector<ComputationResult> TuningRunner::tuneKernel(const KernelId id, std::
 
     size_t configurationCount = configurationManager.getConfigurationCount(id);
     std::vector<ComputationResult> results;
+    interferenceDetector.reset();
+    const std::map<std::string, uint64_t> previousFailureCauses = kernelRunner->getCompilationFailureCauses();
 
     if (stopCondition != nullptr)
     {
@@ -47,14 +55,19 @@ std::vector<ComputationResult> TuningRunner::tuneKernel(const KernelId id, std::
         configurationCount = std::min(configurationCount, stopCondition->getConfigurationCount());
     }
 
+    kernelRunner->setAsynchronousValidation(asynchronousValidationFlag);
+
     for (size_t i = 0; i < configurationCount; ++i)
     {
         std::stringstream stream;
         stream << "Launching configuration " << i + 1 << "/" << configurationCount << " for kernel " << kernel.getName();
         Logger::logInfo(stream.str());
 
+        interferenceDetector.beginMeasurement();
         const ComputationResult result = tuneKernelByStep(id, KernelRunMode::OfflineTuning, std::vector<OutputDescriptor>{}, false);
         results.push_back(result);
+        applyDeferredValidation(id, results);
+        detectInterference(id, results);
 
         if (stopCondition != nullptr)
         {
@@ -68,6 +81,11 @@ std::vector<ComputationResult> TuningRunner::tuneKernel(const KernelId id, std::
         }
     }
 
+    kernelRunner->setAsynchronousValidation(false);
+    applyDeferredValidation(id, results);
+    remeasureAffectedConfigurations(id, results);
+    remeasureFinalists(id, results);
+    reportCompilationFailures(kernel.getName(), previousFailureCauses);
     kernelRunner->clearBuffers();
     kernelRunner->clearReferenceResult(id);
     configurationManager.clearKernelData(id, false, false);
@@ -169,6 +187,8 @@ std::vector<ComputationResult> TuningRunner::tuneComposition(const KernelId id,
 
     size_t configurationCount = configurationManager.getConfigurationCount(id);
     std::vector<ComputationResult> results;
+    interferenceDetector.reset();
+    const std::map<std::string, uint64_t> previousFailureCauses = kernelRunner->getCompilationFailureCauses();
 
     if (stopCondition != nullptr)
     {
@@ -176,14 +196,19 @@ std::vector<ComputationResult> TuningRunner::tuneComposition(const KernelId id,
         configurationCount = std::min(configurationCount, stopCondition->getConfigurationCount());
     }
 
+    kernelRunner->setAsynchronousValidation(asynchronousValidationFlag);
+
     for (size_t i = 0; i < configurationCount; ++i)
     {
         std::stringstream stream;
         stream << "Launching configuration " << i + 1 << "/" << configurationCount << " for kernel composition " << composition.getName();
         Logger::logInfo(stream.str());
 
+        interferenceDetector.beginMeasurement();
         const ComputationResult result = tuneCompositionByStep(id, KernelRunMode::OfflineTuning, std::vector<OutputDescriptor>{}, false);
         results.push_back(result);
+        applyDeferredValidation(id, results);
+        detectInterference(id, results);
 
         if (stopCondition != nullptr)
         {
@@ -197,6 +222,11 @@ std::vector<ComputationResult> TuningRunner::tuneComposition(const KernelId id,
         }
     }
 
+    kernelRunner->setAsynchronousValidation(false);
+    applyDeferredValidation(id, results);
+    remeasureAffectedConfigurations(id, results);
+    remeasureFinalists(id, results);
+    reportCompilationFailures(composition.getName(), previousFailureCauses);
     kernelRunner->clearBuffers();
     kernelRunner->clearReferenceResult(id);
     configurationManager.clearKernelData(id, false, false);
@@ -223,11 +253,14 @@ ComputationResult TuningRunner::tuneKernelByStep(const KernelId id, const Kernel
     }
 
     KernelConfiguration currentConfiguration = configurationManager.getCurrentConfiguration(kernel);
+    updateIncumbentDuration(id);
+    precompileUpcomingConfigurations(id);
     KernelResult result = kernelRunner->runKernel(id, mode, currentConfiguration, output);
+    ComputationResult computationResult = ConfigurationManager::getComputationResult(result);
 
     if (!kernelRunner->getKernelProfiling() || result.getProfilingData().getRemainingProfilingRuns() == 0)
     {
-        configurationManager.calculateNextConfiguration(kernel, result);
+        computationResult = configurationManager.calculateNextConfiguration(kernel, result);
         resultPrinter.addResult(id, result);
     }
 
@@ -238,14 +271,7 @@ ComputationResult TuningRunner::tuneKernelByStep(const KernelId id, const Kernel
 
     kernelRunner->clearBuffers(ArgumentAccessType::WriteOnly);
     kernelRunner->clearBuffers(ArgumentAccessType::ReadWrite);
-
-    if (!result.isValid())
-    {
-        return ComputationResult(result.getKernelName(), result.getConfiguration().getParameterPairs(), result.getErrorMessage());
-    }
-
-    return ComputationResult(result.getKernelName(), result.getConfiguration().getParameterPairs(), result.getComputationDuration(),
-        result.getCompilationData(), result.getProfilingData());
+    return computationResult;
 }
 
 ComputationResult TuningRunner::tuneCompositionByStep(const KernelId id, const KernelRunMode mode, const std::vector<OutputDescriptor>& output,
@@ -268,23 +294,19 @@ ComputationResult TuningRunner::tuneCompositionByStep(const KernelId id, const K
     }
 
     KernelConfiguration currentConfiguration = configurationManager.getCurrentConfiguration(composition);
+    updateIncumbentDuration(id);
+    precompileUpcomingConfigurations(id);
     KernelResult result = kernelRunner->runComposition(id, mode, currentConfiguration, output);
+    ComputationResult computationResult = ConfigurationManager::getComputationResult(result);
     
     if (!kernelRunner->getKernelProfiling() || result.getProfilingData().getRemainingProfilingRuns() == 0)
     {
-        configurationManager.calculateNextConfiguration(composition, result);
+        computationResult = configurationManager.calculateNextConfiguration(composition, result);
         resultPrinter.addResult(id, result);
     }
     
     kernelRunner->clearBuffers();
-
-    if (!result.isValid())
-    {
-        return ComputationResult(result.getKernelName(), result.getConfiguration().getParameterPairs(), result.getErrorMessage());
-    }
-
-    return ComputationResult(result.getKernelName(), result.getConfiguration().getParameterPairs(), result.getComputationDuration(),
-        result.getCompositionCompilationData(), result.getCompositionProfilingData());
+    return computationResult;
 }
 
 void TuningRunner::clearKernelData(const KernelId id, const bool clearConfigurations)
@@ -293,6 +315,32 @@ void TuningRunner::clearKernelData(const KernelId id, const bool clearConfigurat
     configurationManager.clearKernelData(id, clearConfigurations, true);
 }
 
+void TuningRunner::setFinalistRemeasurement(const size_t finalistCount, const size_t rounds)
+{
+    this->finalistCount = finalistCount;
+    this->finalistRounds = rounds;
+}
+
+void TuningRunner::setInterferenceDetection(const size_t sentinelInterval, const double driftThreshold, const double loadThreshold)
+{
+    interferenceDetector.setParameters(sentinelInterval, driftThreshold, loadThreshold);
+}
+
+void TuningRunner::setCompilationLookahead(const size_t count)
+{
+    compilationLookahead = count;
+}
+
+void TuningRunner::setSpeculativeCompilation(const size_t candidateCount)
+{
+    speculativeCandidateCount = candidateCount;
+}
+
+void TuningRunner::setAsynchronousValidation(const bool flag)
+{
+    asynchronousValidationFlag = flag;
+}
+
 void TuningRunner::setKernelProfiling(const bool flag)
 {
     kernelRunner->setKernelProfiling(flag);
@@ -303,11 +351,63 @@ void TuningRunner::setSearchMethod(const SearchMethod method, const std::vector<
     configurationManager.setSearchMethod(method, arguments);
 }
 
+void TuningRunner::setSearcher(const KernelId id, std::unique_ptr<Searcher> searcher)
+{
+    configurationManager.setSearcher(id, std::move(searcher));
+}
+
+void TuningRunner::setWarmStart(const KernelId id, const std::vector<std::string>& filePaths, const size_t seedCount)
+{
+    const std::vector<KernelParameter>& parameters = kernelManager->isComposition(id) ? kernelManager->getKernelComposition(id).getParameters()
+        : kernelManager->getKernel(id).getParameters();
+    std::vector<std::vector<std::vector<ParameterPair>>> fileConfigurations;
+
+    for (const auto& filePath : filePaths)
+    {
+        ResultLoader resultLoader;
+        if (!resultLoader.loadResults(filePath, true))
+        {
+            throw std::runtime_error(std::string("Unable to open file: ") + filePath);
+        }
+        fileConfigurations.push_back(resultLoader.getBestConfigurations(parameters, seedCount));
+    }
+
+    // Durations from different files are not comparable, best configurations from each file are interleaved by their rank
+    std::vector<std::vector<ParameterPair>> seedConfigurations;
+    for (size_t rank = 0; rank < seedCount; rank++)
+    {
+        for (const auto& configurations : fileConfigurations)
+        {
+            if (rank < configurations.size())
+            {
+                seedConfigurations.push_back(configurations[rank]);
+            }
+        }
+    }
+
+    configurationManager.setWarmStartConfigurations(id, seedConfigurations);
+}
+
+void TuningRunner::addObjective(const KernelId id, const TuningObjective& objective)
+{
+    configurationManager.addObjective(id, objective);
+}
+
+void TuningRunner::clearObjectives(const KernelId id)
+{
+    configurationManager.clearObjectives(id);
+}
+
 ComputationResult TuningRunner::getBestComputationResult(const KernelId id) const
 {
     return configurationManager.getBestComputationResult(id);
 }
 
+std::vector<ComputationResult> TuningRunner::getParetoFront(const KernelId id) const
+{
+    return configurationManager.getParetoFront(id);
+}
+
 void TuningRunner::setTimeUnit(const TimeUnit unit)
 {
     resultPrinter.setTimeUnit(unit);
@@ -335,6 +435,40 @@ void TuningRunner::printResult(const KernelId id, const std::string& filePath, c
     resultPrinter.printResult(id, outputFile, format);
 }
 
+void TuningRunner::updateIncumbentDuration(const KernelId id)
+{
+    const ComputationResult bestResult = configurationManager.getBestComputationResult(id);
+
+    // Provisional result may turn out to be incorrect, previous incumbent is kept until its validation completes. Validation is only one
+    // configuration deep, so the previous incumbent has already been validated.
+    if (bestResult.getStatus() && kernelRunner->isValidationPending(bestResult))
+    {
+        return;
+    }
+
+    if (bestResult.getStatus())
+    {
+        kernelRunner->setIncumbentDuration(id, bestResult.getDuration());
+    }
+    else
+    {
+        kernelRunner->clearIncumbentDuration(id);
+    }
+}
+
+void TuningRunner::precompileUpcomingConfigurations(const KernelId id)
+{
+    for (const auto& configuration : configurationManager.getUpcomingConfigurations(id, compilationLookahead))
+    {
+        kernelRunner->precompileKernel(id, configuration, false);
+    }
+
+    for (const auto& configuration : configurationManager.getLikelyConfigurations(id, speculativeCandidateCount))
+    {
+        kernelRunner->precompileKernel(id, configuration, true);
+    }
+}
+
 bool TuningRunner::hasWritableZeroCopyArguments(const Kernel& kernel) const
 {
     std::vector<KernelArgument*> arguments = argumentManager->getArguments(kernel.getArgumentIds());
@@ -350,4 +484,319 @@ bool TuningRunner::hasWritableZeroCopyArguments(const Kernel& kernel) const
     return false;
 }
 
+void TuningRunner::remeasureFinalists(const KernelId id, std::vector<ComputationResult>& results)
+{
+    if (finalistCount == 0 || finalistRounds == 0 || kernelRunner->getKernelProfiling())
+    {
+        return;
+    }
+
+    // Finalists are referenced by their indices, so that their results can be replaced with re-measured ones
+    std::vector<size_t> finalists;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        if (results[i].getStatus() && !results[i].isCensored() && results[i].getObjectiveValue() < std::numeric_limits<double>::max())
+        {
+            finalists.push_back(i);
+        }
+    }
+
+    std::stable_sort(finalists.begin(), finalists.end(), [&results](const size_t first, const size_t second)
+    {
+        return results[first].getObjectiveValue() < results[second].getObjectiveValue();
+    });
+
+    if (finalists.size() > finalistCount)
+    {
+        finalists.resize(finalistCount);
+    }
+
+    if (finalists.empty())
+    {
+        return;
+    }
+
+    std::stringstream stream;
+    stream << "Re-measuring " << finalists.size() << " best configurations for kernel " << results[finalists[0]].getKernelName() << " in "
+        << finalistRounds << " interleaved rounds";
+    Logger::logInfo(stream.str());
+
+    std::vector<KernelConfiguration> configurations;
+    for (const size_t finalist : finalists)
+    {
+        configurations.push_back(getLaunchConfiguration(id, results[finalist].getConfiguration()));
+    }
+
+    std::vector<KernelResult> finalistResults(finalists.size());
+    std::vector<std::vector<uint64_t>> durations(finalists.size());
+    std::vector<std::vector<uint64_t>> kernelTimes(finalists.size());
+    std::vector<bool> failed(finalists.size(), false);
+
+    for (size_t round = 0; round < finalistRounds; ++round)
+    {
+        // Order of finalists is rotated in each round, so that slow drift of device performance affects all of them equally
+        for (size_t j = 0; j < finalists.size(); ++j)
+        {
+            const size_t index = (j + round) % finalists.size();
+            if (failed[index])
+            {
+                continue;
+            }
+
+            const KernelResult result = runConfiguration(id, configurations[index]);
+            if (!result.isValid() || result.isCensored())
+            {
+                failed[index] = true;
+                continue;
+            }
+
+            finalistResults[index] = result;
+            durations[index].push_back(result.getComputationDuration());
+            kernelTimes[index].push_back(result.getKernelTime());
+        }
+    }
+
+    std::vector<KernelResult> remeasuredResults;
+    for (size_t i = 0; i < finalists.size(); ++i)
+    {
+        if (failed[i])
+        {
+            continue;
+        }
+
+        const MeasurementStatistics statistics(durations[i]);
+        KernelResult& result = finalistResults[i];
+        result.setComputationDuration(statistics.getStatistic(kernelRunner->getMeasurementStatistic()));
+        result.setKernelTime(MeasurementStatistics(kernelTimes[i]).getStatistic(kernelRunner->getMeasurementStatistic()));
+        result.setMeasurementStatistics(statistics);
+        resultPrinter.replaceResult(id, result);
+        results[finalists[i]] = configurationManager.evaluateResult(id, result);
+        remeasuredResults.push_back(result);
+    }
+
+    const ComputationResult bestResult = configurationManager.selectBestResult(id, remeasuredResults);
+    if (bestResult.getStatus())
+    {
+        std::stringstream bestStream;
+        bestStream << "Best configuration after re-measurement has duration " << bestResult.getDuration() << "ns measured in "
+            << bestResult.getMeasurementStatistics().getMeasurementCount() << " rounds";
+        Logger::logInfo(bestStream.str());
+    }
+}
+
+void TuningRunner::detectInterference(const KernelId id, const std::vector<ComputationResult>& results)
+{
+    if (!interferenceDetector.isEnabled() || kernelRunner->getKernelProfiling() || results.empty())
+    {
+        return;
+    }
+
+    const ComputationResult& result = results.back();
+    if (interferenceDetector.endMeasurement(results.size() - 1))
+    {
+        Logger::logInfo("High host load detected during recent measurements, affected configurations will be re-measured");
+    }
+
+    if (!interferenceDetector.isSentinelEnabled())
+    {
+        return;
+    }
+
+    // The first successfully measured configuration becomes sentinel, its duration right after selection is used as a baseline
+    if (!interferenceDetector.hasSentinel())
+    {
+        if (result.getStatus() && !result.isCensored())
+        {
+            const KernelResult sentinelResult = runConfiguration(id, getLaunchConfiguration(id, result.getConfiguration()));
+            if (sentinelResult.isValid() && !sentinelResult.isCensored())
+            {
+                interferenceDetector.setSentinel(result.getConfiguration(), sentinelResult.getComputationDuration(), results.size());
+            }
+        }
+        return;
+    }
+
+    if (!interferenceDetector.isSentinelDue(results.size()))
+    {
+        return;
+    }
+
+    const KernelResult sentinelResult = runConfiguration(id, getLaunchConfiguration(id, interferenceDetector.getSentinel()));
+    if (!sentinelResult.isValid() || sentinelResult.isCensored())
+    {
+        interferenceDetector.clearSentinel();
+        return;
+    }
+
+    if (interferenceDetector.checkSentinel(sentinelResult.getComputationDuration(), results.size()))
+    {
+        Logger::logWarning("Duration of sentinel configuration drifted, configurations measured since the last check will be re-measured");
+    }
+}
+
+void TuningRunner::remeasureAffectedConfigurations(const KernelId id, std::vector<ComputationResult>& results)
+{
+    const std::set<size_t>& affectedMeasurements = interferenceDetector.getAffectedMeasurements();
+    if (affectedMeasurements.empty())
+    {
+        return;
+    }
+
+    size_t remeasuredCount = 0;
+    for (const auto index : affectedMeasurements)
+    {
+        // Failed configurations are not re-measured, interference does not affect correctness of computation
+        if (index >= results.size() || !results[index].getStatus())
+        {
+            continue;
+        }
+
+        // Censored result only provides lower bound of duration, so it does not replace the original measurement
+        const KernelResult result = runConfiguration(id, getLaunchConfiguration(id, results[index].getConfiguration()));
+        if (!result.isValid() || result.isCensored())
+        {
+            continue;
+        }
+
+        resultPrinter.replaceResult(id, result);
+        results[index] = configurationManager.evaluateResult(id, result);
+        ++remeasuredCount;
+    }
+
+    std::stringstream stream;
+    stream << "Interference was detected during " << affectedMeasurements.size() << " out of " << results.size() << " measurements of kernel "
+        << results[0].getKernelName() << ", " << remeasuredCount << " configurations were re-measured";
+    Logger::logWarning(stream.str());
+
+    std::vector<KernelResult> kernelResults;
+    for (const auto& result : results)
+    {
+        if (result.getStatus())
+        {
+            kernelResults.push_back(getKernelResult(id, result));
+        }
+    }
+
+    configurationManager.selectBestResult(id, kernelResults);
+}
+
+void TuningRunner::applyDeferredValidation(const KernelId id, std::vector<ComputationResult>& results)
+{
+    const std::vector<KernelResult> invalidatedResults = kernelRunner->getInvalidatedResults();
+    if (invalidatedResults.empty())
+    {
+        return;
+    }
+
+    for (const auto& invalidatedResult : invalidatedResults)
+    {
+        resultPrinter.replaceResult(id, invalidatedResult);
+
+        for (auto& result : results)
+        {
+            if (result.getStatus() && ResultPrinter::hasEqualParameterPairs(result.getConfiguration(),
+                invalidatedResult.getConfiguration().getParameterPairs()))
+            {
+                result = configurationManager.evaluateResult(id, invalidatedResult);
+            }
+        }
+    }
+
+    // Best configuration may have been selected based on provisional result, searcher and Pareto front keep provisional results
+    std::vector<KernelResult> kernelResults;
+    for (const auto& result : results)
+    {
+        kernelResults.push_back(getKernelResult(id, result));
+    }
+
+    configurationManager.selectBestResult(id, kernelResults);
+}
+
+void TuningRunner::reportCompilationFailures(const std::string& kernelName, const std::map<std::string, uint64_t>& previousCauses) const
+{
+    std::stringstream stream;
+    uint64_t failureCount = 0;
+
+    for (const auto& cause : kernelRunner->getCompilationFailureCauses())
+    {
+        const auto previousCause = previousCauses.find(cause.first);
+        const uint64_t count = cause.second - (previousCause == previousCauses.cend() ? 0 : previousCause->second);
+
+        if (count > 0)
+        {
+            stream << std::endl << count << "x " << cause.first;
+            failureCount += count;
+        }
+    }
+
+    if (failureCount > 0)
+    {
+        Logger::logWarning(std::string("Compilation failed for ") + std::to_string(failureCount) + " programs of kernel " + kernelName
+            + ", including programs rejected due to previously recorded failures. Failure causes:" + stream.str());
+    }
+}
+
+KernelResult TuningRunner::runConfiguration(const KernelId id, const KernelConfiguration& configuration)
+{
+    // Configuration is measured on its own, it is never terminated early based on duration of the best configuration
+    kernelRunner->clearIncumbentDuration(id);
+    KernelResult result;
+
+    if (kernelManager->isComposition(id))
+    {
+        result = kernelRunner->runComposition(id, KernelRunMode::OfflineTuning, configuration, std::vector<OutputDescriptor>{});
+        kernelRunner->clearBuffers();
+        return result;
+    }
+
+    result = kernelRunner->runKernel(id, KernelRunMode::OfflineTuning, configuration, std::vector<OutputDescriptor>{});
+
+    if (kernelManager->getKernel(id).hasTuningManipulator())
+    {
+        kernelRunner->clearBuffers(ArgumentAccessType::ReadOnly);
+    }
+
+    kernelRunner->clearBuffers(ArgumentAccessType::WriteOnly);
+    kernelRunner->clearBuffers(ArgumentAccessType::ReadWrite);
+    return result;
+}
+
+KernelResult TuningRunner::getKernelResult(const KernelId id, const ComputationResult& result) const
+{
+    const KernelConfiguration configuration = getLaunchConfiguration(id, result.getConfiguration());
+    if (!result.getStatus())
+    {
+        return KernelResult(result.getKernelName(), configuration, result.getErrorMessage());
+    }
+
+    KernelResult kernelResult(result.getKernelName(), configuration);
+    kernelResult.setComputationDuration(result.getDuration());
+    kernelResult.setCompilationData(result.getCompilationData());
+    kernelResult.setProfilingData(result.getProfilingData());
+
+    for (const auto& compilationData : result.getCompositionCompilationData())
+    {
+        kernelResult.setCompositionKernelCompilationData(compilationData.first, compilationData.second);
+    }
+
+    for (const auto& profilingData : result.getCompositionProfilingData())
+    {
+        kernelResult.setCompositionKernelProfilingData(profilingData.first, profilingData.second);
+    }
+
+    kernelResult.setMeasurementStatistics(result.getMeasurementStatistics());
+    kernelResult.setCensored(result.isCensored());
+    return kernelResult;
+}
+
+KernelConfiguration TuningRunner::getLaunchConfiguration(const KernelId id, const std::vector<ParameterPair>& configuration) const
+{
+    if (kernelManager->isComposition(id))
+    {
+        return kernelManager->getKernelCompositionConfiguration(id, configuration);
+    }
+
+    return kernelManager->getKernelConfiguration(id, configuration);
+}
+
 } // namespace ktt
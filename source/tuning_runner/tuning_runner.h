@@ -10,6 +10,7 @@
 #include <kernel/kernel_manager.h>
 #include <kernel_argument/argument_manager.h>
 #include <tuning_runner/configuration_manager.h>
+#include <tuning_runner/interference_detector.h>
 #include <tuning_runner/kernel_runner.h>
 #include <utility/result_printer.h>
 
@@ -31,9 +32,19 @@ public:
     ComputationResult tuneCompositionByStep(const KernelId id, const KernelRunMode mode, const std::vector<OutputDescriptor>& output,
         const bool recomputeReference);
     void clearKernelData(const KernelId id, const bool clearConfigurations);
+    void setFinalistRemeasurement(const size_t finalistCount, const size_t rounds);
+    void setInterferenceDetection(const size_t sentinelInterval, const double driftThreshold, const double loadThreshold);
+    void setCompilationLookahead(const size_t count);
+    void setSpeculativeCompilation(const size_t candidateCount);
+    void setAsynchronousValidation(const bool flag);
     void setKernelProfiling(const bool flag);
     void setSearchMethod(const SearchMethod method, const std::vector<double>& arguments);
+    void setSearcher(const KernelId id, std::unique_ptr<Searcher> searcher);
+    void setWarmStart(const KernelId id, const std::vector<std::string>& filePaths, const size_t seedCount);
+    void addObjective(const KernelId id, const TuningObjective& objective);
+    void clearObjectives(const KernelId id);
     ComputationResult getBestComputationResult(const KernelId id) const;
+    std::vector<ComputationResult> getParetoFront(const KernelId id) const;
 
     // Result printer methods
     void setTimeUnit(const TimeUnit unit);
@@ -48,9 +59,25 @@ private:
     KernelRunner* kernelRunner;
     ConfigurationManager configurationManager;
     ResultPrinter resultPrinter;
+    InterferenceDetector interferenceDetector;
+    size_t finalistCount;
+    size_t finalistRounds;
+    size_t compilationLookahead;
+    size_t speculativeCandidateCount;
+    bool asynchronousValidationFlag;
 
     // Helper methods
     bool hasWritableZeroCopyArguments(const Kernel& kernel) const;
+    void updateIncumbentDuration(const KernelId id);
+    void precompileUpcomingConfigurations(const KernelId id);
+    void remeasureFinalists(const KernelId id, std::vector<ComputationResult>& results);
+    void detectInterference(const KernelId id, const std::vector<ComputationResult>& results);
+    void remeasureAffectedConfigurations(const KernelId id, std::vector<ComputationResult>& results);
+    void applyDeferredValidation(const KernelId id, std::vector<ComputationResult>& results);
+    void reportCompilationFailures(const std::string& kernelName, const std::map<std::string, uint64_t>& previousCauses) const;
+    KernelResult runConfiguration(const KernelId id, const KernelConfiguration& configuration);
+    KernelResult getKernelResult(const KernelId id, const ComputationResult& result) const;
+    KernelConfiguration getLaunchConfiguration(const KernelId id, const std::vector<ParameterPair>& configuration) const;
 };
 
 } // namespace ktt
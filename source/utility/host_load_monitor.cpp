@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility/host_load_monitor.h>
+
+namespace ktt
+{
+
+// Minimum length of measurement window in clock ticks per processor
+const uint64_t minimumWindowTicks = 10;
+
+HostLoadMonitor::HostLoadMonitor() :
+    initialBusyTime(0),
+    initialTotalTime(0),
+    initialProcessTime(0),
+    endBusyTime(0),
+    endTotalTime(0),
+    endProcessTime(0),
+    windowOpen(false),
+    loadKnown(false)
+{}
+
+void HostLoadMonitor::start()
+{
+    // Window which did not reach minimum length yet is extended by the following measurement
+    if (!windowOpen)
+    {
+        windowOpen = readHostTimes(initialBusyTime, initialTotalTime) && readProcessTime(initialProcessTime);
+    }
+}
+
+void HostLoadMonitor::stop()
+{
+    loadKnown = false;
+
+    if (!windowOpen)
+    {
+        return;
+    }
+
+    if (!readHostTimes(endBusyTime, endTotalTime) || !readProcessTime(endProcessTime) || endTotalTime < initialTotalTime)
+    {
+        windowOpen = false;
+        return;
+    }
+
+    // Aggregated host times are summed over all processors
+    const uint64_t processorCount = std::max(std::thread::hardware_concurrency(), 1u);
+    loadKnown = endTotalTime - initialTotalTime >= minimumWindowTicks * processorCount;
+    windowOpen = !loadKnown;
+}
+
+bool HostLoadMonitor::hasLoad() const
+{
+    return loadKnown;
+}
+
+double HostLoadMonitor::getLoad() const
+{
+    if (!loadKnown)
+    {
+        return 0.0;
+    }
+
+    // CPU time consumed by tuner process itself is not considered to be an interference
+    const uint64_t busyTime = endBusyTime - initialBusyTime;
+    const uint64_t processTime = endProcessTime - initialProcessTime;
+    const uint64_t foreignTime = busyTime > processTime ? busyTime - processTime : 0;
+
+    return static_cast<double>(foreignTime) / static_cast<double>(endTotalTime - initialTotalTime);
+}
+
+bool HostLoadMonitor::readHostTimes(uint64_t& busyTime, uint64_t& totalTime)
+{
+    std::ifstream file("/proc/stat");
+    std::string line;
+
+    if (!file.is_open() || !std::getline(file, line))
+    {
+        return false;
+    }
+
+    // Aggregated line has the following format: cpu user nice system idle iowait irq softirq steal ...
+    std::istringstream stream(line);
+    std::string label;
+    stream >> label;
+
+    if (label != "cpu")
+    {
+        return false;
+    }
+
+    busyTime = 0;
+    totalTime = 0;
+    uint64_t value;
+
+    for (size_t i = 0; i < 8 && stream >> value; ++i)
+    {
+        totalTime += value;
+        if (i != 3 && i != 4)
+        {
+            busyTime += value;
+        }
+    }
+
+    return totalTime > 0;
+}
+
+bool HostLoadMonitor::readProcessTime(uint64_t& processTime)
+{
+    std::ifstream file("/proc/self/stat");
+    std::string line;
+
+    if (!file.is_open() || !std::getline(file, line))
+    {
+        return false;
+    }
+
+    // Process name may contain spaces, fields are counted from the end of the name
+    const size_t nameEnd = line.rfind(')');
+    if (nameEnd == std::string::npos)
+    {
+        return false;
+    }
+
+    std::istringstream stream(line.substr(nameEnd + 1));
+    std::string field;
+
+    // User and system time are 14th and 15th fields, the name is 2nd field
+    for (size_t i = 3; i < 14; ++i)
+    {
+        if (!(stream >> field))
+        {
+            return false;
+        }
+    }
+
+    uint64_t userTime;
+    uint64_t systemTime;
+    if (!(stream >> userTime >> systemTime))
+    {
+        return false;
+    }
+
+    processTime = userTime + systemTime;
+    return true;
+}
+
+} // namespace ktt
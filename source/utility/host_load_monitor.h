@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+namespace ktt
+{
+
+// Host times are only updated with each clock tick, so measurement window spans consecutive measurements until it reaches minimum length
+class HostLoadMonitor
+{
+public:
+    HostLoadMonitor();
+
+    void start();
+    void stop();
+    bool hasLoad() const;
+    double getLoad() const;
+
+private:
+    uint64_t initialBusyTime;
+    uint64_t initialTotalTime;
+    uint64_t initialProcessTime;
+    uint64_t endBusyTime;
+    uint64_t endTotalTime;
+    uint64_t endProcessTime;
+    bool windowOpen;
+    bool loadKnown;
+
+    static bool readHostTimes(uint64_t& busyTime, uint64_t& totalTime);
+    static bool readProcessTime(uint64_t& processTime);
+};
+
+} // namespace ktt
@@ -1,3 +1,5 @@
+#include <iomanip>
+#include <sstream>
 #include <stdexcept>
 #include <utility/ktt_utility.h>
 
@@ -61,4 +63,23 @@ std::vector<size_t> roundUpGlobalSize(const std::vector<size_t>& globalSize, con
     return result;
 }
 
+uint64_t getFnvHash(const std::string& data, const uint64_t initialHash)
+{
+    uint64_t hash = initialHash;
+
+    for (const char character : data)
+    {
+        hash = (hash ^ static_cast<uint8_t>(character)) * 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+std::string getHexString(const uint64_t number)
+{
+    std::stringstream stream;
+    stream << std::hex << std::setw(16) << std::setfill('0') << number;
+    return stream.str();
+}
+
 } // namespace ktt
@@ -19,6 +19,10 @@ std::string getTimeUnitTag(const TimeUnit unit);
 size_t roundUp(const size_t number, const size_t multiple);
 std::vector<size_t> roundUpGlobalSize(const std::vector<size_t>& globalSize, const std::vector<size_t>& localSize);
 
+const uint64_t fnvOffsetBasis = 14695981039346656037ULL;
+uint64_t getFnvHash(const std::string& data, const uint64_t initialHash = fnvOffsetBasis);
+std::string getHexString(const uint64_t number);
+
 template <typename T>
 bool containsElement(const std::vector<T>& vector, const T& element)
 {
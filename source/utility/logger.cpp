@@ -36,6 +36,9 @@ void Logger::log(const LoggingLevel level, const std::string& message) const
         return;
     }
 
+    // Messages can be logged from worker threads, eg. during asynchronous result validation
+    std::lock_guard<std::mutex> lock(mutex);
+
     if (filePathValid)
     {
         std::ofstream outputFile(filePath, std::ios::app | std::ios_base::out);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <enum/logging_level.h>
@@ -32,6 +33,7 @@ private:
     std::ostream* outputTarget;
     bool filePathValid;
     std::string filePath;
+    mutable std::mutex mutex;
 
     Logger();
     static std::string getLoggingLevelString(const LoggingLevel level);
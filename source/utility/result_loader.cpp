@@ -2,15 +2,18 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 #include <utility/result_loader.h>
 
 namespace ktt
 {
 
-bool ResultLoader::loadResults(const std::string& filePath) 
+bool ResultLoader::loadResults(const std::string& filePath, const bool validResultsOnly)
 {
     values.clear();
+    columnNames.clear();
+    rows.clear();
 
     std::ifstream inputFile(filePath, std::ios::app | std::ios_base::out);
 
@@ -35,6 +38,7 @@ bool ResultLoader::loadResults(const std::string& filePath)
         std::getline(ss, substr, ',');
         params.push_back(substr);
     }
+    columnNames = params;
 
     // backward compatibility, new version produces Computation duration only
     if (params[1] == "Kernel duration (us)")
@@ -47,7 +51,7 @@ bool ResultLoader::loadResults(const std::string& filePath)
         timeIndex = 2;
         paramsBegin = 5;
     }
-    else if (params[1] == "Computation duration (us)")
+    else if (params[1].compare(0, 20, "Computation duration") == 0)
     {
         timeIndex = 1;
         paramsBegin = 4;
@@ -69,6 +73,12 @@ bool ResultLoader::loadResults(const std::string& filePath)
     
     while (std::getline(inputFile, line)) 
     {
+        // Valid results are separated from invalid results by an empty line
+        if (validResultsOnly && (line.empty() || line == "\r"))
+        {
+            break;
+        }
+
         params.clear();
         std::stringstream ss(line);
         while (ss.good())
@@ -87,6 +97,7 @@ bool ResultLoader::loadResults(const std::string& filePath)
         for (size_t i = paramsBegin; i < paramsBegin+paramsLength; i++)
             runValues.push_back(std::stoi(params[i]));
         values.push_back(runValues);
+        rows.push_back(params);
     }
     return true;
 }
@@ -121,4 +132,61 @@ KernelResult ResultLoader::readResult(const KernelConfiguration& configuration)
     throw std::runtime_error("Kernel measurement not found");
 }
 
+std::vector<std::vector<ParameterPair>> ResultLoader::getBestConfigurations(const std::vector<KernelParameter>& parameters,
+    const size_t count) const
+{
+    std::vector<std::pair<const KernelParameter*, size_t>> parameterColumns;
+
+    for (const auto& parameter : parameters)
+    {
+        for (size_t i = paramsBegin; i < columnNames.size(); i++)
+        {
+            if (columnNames[i] == parameter.getName())
+            {
+                parameterColumns.push_back(std::make_pair(&parameter, i));
+                break;
+            }
+        }
+    }
+
+    if (parameterColumns.empty())
+    {
+        throw std::runtime_error("Loaded results do not contain any of the kernel tuning parameters");
+    }
+
+    std::vector<std::pair<double, size_t>> orderedRows;
+    for (size_t i = 0; i < rows.size(); i++)
+    {
+        orderedRows.push_back(std::make_pair(std::stod(rows[i][timeIndex]), i));
+    }
+
+    std::stable_sort(orderedRows.begin(), orderedRows.end(), [](const auto& first, const auto& second)
+    {
+        return first.first < second.first;
+    });
+
+    std::vector<std::vector<ParameterPair>> result;
+    for (size_t i = 0; i < std::min(count, orderedRows.size()); i++)
+    {
+        const std::vector<std::string>& row = rows[orderedRows[i].second];
+        std::vector<ParameterPair> pairs;
+
+        for (const auto& column : parameterColumns)
+        {
+            if (column.first->hasValuesDouble())
+            {
+                pairs.emplace_back(column.first->getName(), std::stod(row[column.second]));
+            }
+            else
+            {
+                pairs.emplace_back(column.first->getName(), static_cast<size_t>(std::stoull(row[column.second])));
+            }
+        }
+
+        result.push_back(pairs);
+    }
+
+    return result;
+}
+
 } // namespace ktt
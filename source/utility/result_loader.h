@@ -4,8 +4,10 @@
 #include <map>
 #include <string>
 #include <vector>
+#include <api/parameter_pair.h>
 #include <dto/kernel_result.h>
 #include <enum/time_unit.h>
+#include <kernel/kernel_parameter.h>
 
 namespace ktt
 {
@@ -13,11 +15,15 @@ namespace ktt
 class ResultLoader
 {
 public:
-    bool loadResults(const std::string& filePath);
+    // Reading can stop at the block of invalid results which follows valid results, otherwise the block is reported as malformed
+    bool loadResults(const std::string& filePath, const bool validResultsOnly = false);
     KernelResult readResult(const KernelConfiguration& configuration);
+    std::vector<std::vector<ParameterPair>> getBestConfigurations(const std::vector<KernelParameter>& parameters, const size_t count) const;
 
 private:
     std::vector<std::vector<int>> values;
+    std::vector<std::string> columnNames;
+    std::vector<std::vector<std::string>> rows;
     int timeIndex;
     size_t paramsBegin;
     size_t paramsLength;
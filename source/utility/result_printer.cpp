@@ -47,6 +47,27 @@ void ResultPrinter::setResult(const KernelId id, const std::vector<KernelResult>
     kernelResults[id] = results;
 }
 
+void ResultPrinter::replaceResult(const KernelId id, const KernelResult& result)
+{
+    if (!containsKey(kernelResults, id))
+    {
+        addResult(id, result);
+        return;
+    }
+
+    for (auto& existingResult : kernelResults[id])
+    {
+        if (existingResult.isValid() && hasEqualParameterPairs(existingResult.getConfiguration().getParameterPairs(),
+            result.getConfiguration().getParameterPairs()))
+        {
+            existingResult = result;
+            return;
+        }
+    }
+
+    kernelResults[id].push_back(result);
+}
+
 void ResultPrinter::setTimeUnit(const TimeUnit unit)
 {
     this->timeUnit = unit;
@@ -553,4 +574,28 @@ KernelResult ResultPrinter::getBestResult(const std::vector<KernelResult>& resul
     return bestResult;
 }
 
+bool ResultPrinter::hasEqualParameterPairs(const std::vector<ParameterPair>& first, const std::vector<ParameterPair>& second)
+{
+    if (first.size() != second.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < first.size(); ++i)
+    {
+        if (first[i].getName() != second[i].getName())
+        {
+            return false;
+        }
+
+        if ((first[i].hasValueDouble() && !floatEquals(first[i].getValueDouble(), second[i].getValueDouble()))
+            || (!first[i].hasValueDouble() && first[i].getValue() != second[i].getValue()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 } // namespace ktt
@@ -18,9 +18,11 @@ public:
     void printResult(const KernelId id, std::ostream& outputTarget, const PrintFormat format) const;
     void addResult(const KernelId id, const KernelResult& result);
     void setResult(const KernelId id, const std::vector<KernelResult>& results);
+    void replaceResult(const KernelId id, const KernelResult& result);
     void setTimeUnit(const TimeUnit unit);
     void setInvalidResultPrinting(const bool flag);
     void clearResults(const KernelId id);
+    static bool hasEqualParameterPairs(const std::vector<ParameterPair>& first, const std::vector<ParameterPair>& second);
 
 private:
     std::map<KernelId, std::vector<KernelResult>> kernelResults;
@@ -0,0 +1,131 @@
+#include <limits>
+#include <stdexcept>
+#include <utility/thread_pool.h>
+
+namespace ktt
+{
+
+ThreadPool::ThreadPool(const size_t threadCount) :
+    threadCount(threadCount),
+    stopFlag(false),
+    lowPriorityTaskLimit(std::numeric_limits<size_t>::max())
+{
+    if (threadCount == 0)
+    {
+        throw std::runtime_error("Number of threads in thread pool must be greater than zero");
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    // Tasks which did not start yet are discarded, their futures report broken promise
+    stopThreads(true);
+}
+
+void ThreadPool::setThreadCount(const size_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        throw std::runtime_error("Number of threads in thread pool must be greater than zero");
+    }
+
+    stopThreads(false);
+    std::lock_guard<std::mutex> lock(mutex);
+    this->threadCount = threadCount;
+}
+
+size_t ThreadPool::getThreadCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return threadCount;
+}
+
+void ThreadPool::setLowPriorityTaskLimit(const size_t limit)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    lowPriorityTaskLimit = limit;
+    trimLowPriorityTasks();
+}
+
+size_t ThreadPool::getHardwareThreadCount()
+{
+    const size_t count = static_cast<size_t>(std::thread::hardware_concurrency());
+    return count == 0 ? 1 : count;
+}
+
+void ThreadPool::startThreads()
+{
+    stopFlag = false;
+
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back(&ThreadPool::processTasks, this);
+    }
+}
+
+void ThreadPool::stopThreads(const bool discardTasks)
+{
+    std::vector<std::thread> stoppedThreads;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (discardTasks)
+        {
+            tasks = std::queue<std::function<void()>>{};
+            lowPriorityTasks.clear();
+        }
+
+        stopFlag = true;
+        stoppedThreads.swap(threads);
+    }
+
+    condition.notify_all();
+
+    for (auto& thread : stoppedThreads)
+    {
+        thread.join();
+    }
+}
+
+void ThreadPool::processTasks()
+{
+    while (true)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this]() { return stopFlag || !tasks.empty() || !lowPriorityTasks.empty(); });
+
+            // Remaining tasks are finished before the thread exits
+            if (!tasks.empty())
+            {
+                task = std::move(tasks.front());
+                tasks.pop();
+            }
+            else if (!lowPriorityTasks.empty())
+            {
+                task = std::move(lowPriorityTasks.front());
+                lowPriorityTasks.pop_front();
+            }
+            else
+            {
+                return;
+            }
+        }
+
+        task();
+    }
+}
+
+void ThreadPool::trimLowPriorityTasks()
+{
+    // The oldest tasks are discarded first, their futures report broken promise
+    while (lowPriorityTasks.size() > lowPriorityTaskLimit)
+    {
+        lowPriorityTasks.pop_front();
+    }
+}
+
+} // namespace ktt
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace ktt
+{
+
+class ThreadPool
+{
+public:
+    explicit ThreadPool(const size_t threadCount);
+    ~ThreadPool();
+
+    // Low priority tasks are only started when there are no other tasks waiting
+    template <typename Function>
+    auto enqueue(Function function, const bool lowPriority = false) -> std::future<decltype(function())>
+    {
+        using ResultType = decltype(function());
+        auto task = std::make_shared<std::packaged_task<ResultType()>>(std::move(function));
+        std::future<ResultType> result = task->get_future();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            // Threads are started lazily, so the pool does not occupy any resources until the first task is submitted
+            if (threads.empty())
+            {
+                startThreads();
+            }
+
+            if (lowPriority)
+            {
+                lowPriorityTasks.emplace_back([task]() { (*task)(); });
+                trimLowPriorityTasks();
+            }
+            else
+            {
+                tasks.emplace([task]() { (*task)(); });
+            }
+        }
+
+        condition.notify_one();
+        return result;
+    }
+
+    void setThreadCount(const size_t threadCount);
+    size_t getThreadCount() const;
+    void setLowPriorityTaskLimit(const size_t limit);
+    static size_t getHardwareThreadCount();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    void operator=(const ThreadPool&) = delete;
+    void operator=(ThreadPool&&) = delete;
+
+private:
+    size_t threadCount;
+    bool stopFlag;
+    std::vector<std::thread> threads;
+    std::queue<std::function<void()>> tasks;
+    std::deque<std::function<void()>> lowPriorityTasks;
+    size_t lowPriorityTaskLimit;
+    mutable std::mutex mutex;
+    std::condition_variable condition;
+
+    void startThreads();
+    void stopThreads(const bool discardTasks);
+    void processTasks();
+    void trimLowPriorityTasks();
+};
+
+} // namespace ktt
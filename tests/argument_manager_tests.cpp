@@ -74,6 +74,21 @@ TEST_CASE("Argument update", "Component: ArgumentManager")
         }
     }
 
+    SECTION("Argument update with data of the same size changes data version")
+    {
+        ktt::ArgumentManager manager;
+
+        std::vector<float> data{1.0f, 2.0f, 3.0f, 4.0f};
+        ktt::ArgumentId id = manager.addArgument(data.data(), data.size(), sizeof(float), ktt::ArgumentDataType::Float,
+            ktt::ArgumentMemoryLocation::Device, ktt::ArgumentAccessType::ReadWrite, ktt::ArgumentUploadType::Vector, true);
+        const uint64_t originalVersion = manager.getArgument(id).getDataVersion();
+
+        std::vector<float> newData{5.0f, 6.0f, 7.0f, 8.0f};
+        manager.updateArgument(id, newData.data(), newData.size());
+
+        REQUIRE(manager.getArgument(id).getDataVersion() != originalVersion);
+    }
+
     SECTION("Argument references data")
     {
         ktt::ArgumentManager manager;
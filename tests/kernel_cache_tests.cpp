@@ -0,0 +1,38 @@
+#include <memory>
+#include <catch.hpp>
+#include <compute_engine/kernel_cache.h>
+
+TEST_CASE("Kernel cache eviction and statistics", "Component: KernelCache")
+{
+    ktt::KernelCache<std::unique_ptr<int>> cache(2);
+    cache.insert("kernel", "source1", std::make_unique<int>(1));
+    cache.insert("kernel", "source2", std::make_unique<int>(2));
+
+    SECTION("Cached kernels are found by name and source")
+    {
+        REQUIRE(cache.find("kernel", "source1") != nullptr);
+        REQUIRE(**cache.find("kernel", "source2") == 2);
+        REQUIRE(cache.find("otherKernel", "source1") == nullptr);
+        REQUIRE(cache.getStatistics().getHitCount() == 2);
+        REQUIRE(cache.getStatistics().getMissCount() == 1);
+    }
+
+    SECTION("Only the least recently used kernel is evicted when the cache is full")
+    {
+        REQUIRE(cache.find("kernel", "source1") != nullptr);
+        cache.insert("kernel", "source3", std::make_unique<int>(3));
+
+        REQUIRE(cache.contains("kernel", "source1"));
+        REQUIRE_FALSE(cache.contains("kernel", "source2"));
+        REQUIRE(cache.contains("kernel", "source3"));
+        REQUIRE(cache.getStatistics().getEvictionCount() == 1);
+        REQUIRE(cache.getSize() == 2);
+    }
+
+    SECTION("Lowering capacity evicts kernels")
+    {
+        cache.setCapacity(1);
+        REQUIRE(cache.getSize() == 1);
+        REQUIRE(cache.contains("kernel", "source2"));
+    }
+}
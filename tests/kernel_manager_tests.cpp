@@ -45,20 +45,43 @@ TEST_CASE("Kernel handling operations", "Component: KernelManager")
 TEST_CASE("Adding defines to kernel source", "Component: KernelManager")
 {
     ktt::KernelManager manager;
-    ktt::KernelId id = manager.addKernelFromFile(KTT_TEST_KERNEL_FILE, "testKernel", ktt::DimensionVector(1024), ktt::DimensionVector(16, 16));
+    const std::string kernelSource(std::string("")
+        + "__kernel void testKernel(__global float* result)\n"
+        + "{\n"
+        + "    result[get_global_id(0)] = param_one * param_two;\n"
+        + "}\n");
+    ktt::KernelId id = manager.addKernel(kernelSource, "testKernel", ktt::DimensionVector(1024), ktt::DimensionVector(16, 16));
     manager.addParameter(id, "param_one", std::vector<size_t>{1, 2, 3});
     manager.addParameter(id, "param_two", std::vector<size_t>{5, 10});
+    manager.addParameter(id, "param_host", std::vector<size_t>{1, 2});
+
+    std::vector<ktt::ParameterPair> parameterPairs;
+    parameterPairs.push_back(ktt::ParameterPair("param_two", static_cast<size_t>(5)));
+    parameterPairs.push_back(ktt::ParameterPair("param_one", static_cast<size_t>(2)));
+    parameterPairs.push_back(ktt::ParameterPair("param_host", static_cast<size_t>(1)));
+    ktt::KernelConfiguration config(manager.getKernel(id).getGlobalSize(), manager.getKernel(id).getLocalSize(), parameterPairs);
 
     SECTION("Kernel source with defines is returned correctly")
     {
-        std::vector<ktt::ParameterPair> parameterPairs;
-        parameterPairs.push_back(ktt::ParameterPair("param_two", static_cast<size_t>(5)));
-        parameterPairs.push_back(ktt::ParameterPair("param_one", static_cast<size_t>(2)));
-
-        ktt::KernelConfiguration config(manager.getKernel(id).getGlobalSize(), manager.getKernel(id).getLocalSize(), parameterPairs);
         std::string source = manager.getKernelSourceWithDefines(id, config);
         std::string expectedSource("#define param_one 2\n#define param_two 5\n" + manager.getKernel(id).getSource());
 
         REQUIRE(source == expectedSource);
     }
+
+    SECTION("Parameter definitions for compiler options are returned correctly")
+    {
+        std::string definitions = manager.getParameterDefinitions(id, config);
+        REQUIRE(definitions == "-Dparam_two=5 -Dparam_one=2");
+    }
+
+    SECTION("Host-only parameters are not added to kernel source")
+    {
+        manager.setHostOnlyParameters(id, std::vector<std::string>{"param_two"});
+        std::string source = manager.getKernelSourceWithDefines(id, config);
+        std::string expectedSource("#define param_one 2\n" + manager.getKernel(id).getSource());
+
+        REQUIRE(source == expectedSource);
+        REQUIRE_THROWS_AS(manager.setHostOnlyParameters(id, std::vector<std::string>{"param_three"}), std::runtime_error);
+    }
 }
@@ -62,3 +62,54 @@ TEST_CASE("Working with OpenCL buffer", "Component: OpenCLEngine")
         }
     }
 }
+
+TEST_CASE("Working with OpenCL argument snapshots", "Component: OpenCLEngine")
+{
+    ktt::OpenCLEngine engine(0, 0, 1);
+    engine.setArgumentSnapshotUsage(true);
+    std::vector<float> data(64, 1.0f);
+
+    auto argument = ktt::KernelArgument(0, data.data(), data.size(), sizeof(float), ktt::ArgumentDataType::Float,
+        ktt::ArgumentMemoryLocation::Device, ktt::ArgumentAccessType::ReadWrite, ktt::ArgumentUploadType::Vector, true);
+
+    SECTION("Argument updated with data of the same size is uploaded again")
+    {
+        engine.uploadArgument(argument);
+        engine.clearBuffers();
+
+        std::vector<float> newData(64, 2.0f);
+        argument.updateData(newData.data(), newData.size());
+        engine.uploadArgument(argument);
+        ktt::KernelArgument resultArgument = engine.downloadArgumentObject(argument.getId(), nullptr);
+
+        const float* result = resultArgument.getDataWithType<float>();
+
+        for (size_t i = 0; i < newData.size(); ++i)
+        {
+            REQUIRE(result[i] == newData[i]);
+        }
+    }
+}
+
+TEST_CASE("Building OpenCL programs in background", "Component: OpenCLEngine")
+{
+    ktt::OpenCLEngine engine(0, 0, 1);
+    engine.setCompilationThreadCount(2);
+
+    std::vector<std::future<std::unique_ptr<ktt::OpenCLProgram>>> programs;
+    for (size_t i = 0; i < 4; i++)
+    {
+        programs.push_back(engine.createAndBuildProgramAsync(programSource));
+    }
+
+    for (auto& program : programs)
+    {
+        REQUIRE(program.get()->getSource() == programSource);
+    }
+
+    SECTION("Building program with invalid source in background throws once the program is retrieved")
+    {
+        auto program = engine.createAndBuildProgramAsync("Invalid");
+        REQUIRE_THROWS(program.get());
+    }
+}
@@ -0,0 +1,288 @@
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+#include <catch.hpp>
+#include <tuning_runner/comparison/comparison_kernels.h>
+#include <tuning_runner/comparison/result_comparator.h>
+
+namespace
+{
+
+// Sums of differences are accumulated in different order by vector kernels
+bool sumsAgree(const double first, const double second)
+{
+    return (std::isnan(first) && std::isnan(second)) || first == Approx(second);
+}
+
+template <typename T>
+void checkKernelsAgree(const ktt::ComparisonKernels<T>& kernels, const ktt::ComparisonKernels<T>& scalarKernels, const std::vector<T>& result,
+    const std::vector<T>& reference)
+{
+    const T* resultData = result.data();
+    const T* referenceData = reference.data();
+
+    // Counts cover empty input and partial vectors of all supported widths
+    for (const size_t count : {size_t(0), size_t(1), size_t(7), size_t(16), size_t(33), result.size()})
+    {
+        REQUIRE(sumsAgree(kernels.sumAbsoluteDifferences(resultData, referenceData, count),
+            scalarKernels.sumAbsoluteDifferences(resultData, referenceData, count)));
+
+        for (const double threshold : {0.0, 1e-3, 0.1})
+        {
+            REQUIRE(kernels.findAbsoluteMismatch(resultData, referenceData, count, threshold)
+                == scalarKernels.findAbsoluteMismatch(resultData, referenceData, count, threshold));
+            REQUIRE(kernels.findRelativeMismatch(resultData, referenceData, count, threshold, 1e-4)
+                == scalarKernels.findRelativeMismatch(resultData, referenceData, count, threshold, 1e-4));
+        }
+
+        for (const uint64_t ulpThreshold : {uint64_t(0), uint64_t(1000), std::numeric_limits<uint64_t>::max() - 1})
+        {
+            REQUIRE(kernels.findUlpMismatch(resultData, referenceData, count, ulpThreshold)
+                == scalarKernels.findUlpMismatch(resultData, referenceData, count, ulpThreshold));
+
+            ktt::ComparisonStatistics statistics{0, 0.0, 0.0, 0};
+            ktt::ComparisonStatistics scalarStatistics{0, 0.0, 0.0, 0};
+            kernels.accumulateStatistics(resultData, referenceData, count, 1e-3, ulpThreshold, statistics);
+            scalarKernels.accumulateStatistics(resultData, referenceData, count, 1e-3, ulpThreshold, scalarStatistics);
+
+            REQUIRE(statistics.maximumUlpDistance == scalarStatistics.maximumUlpDistance);
+            REQUIRE(statistics.maximumDifference == scalarStatistics.maximumDifference);
+            REQUIRE(statistics.withinToleranceCount == scalarStatistics.withinToleranceCount);
+            REQUIRE(sumsAgree(statistics.squaredDifferenceSum, scalarStatistics.squaredDifferenceSum));
+        }
+    }
+}
+
+void checkKernelSetsAgree(const ktt::ComparisonKernelSet& kernels, const ktt::ComparisonKernelSet& scalarKernels)
+{
+    const size_t count = 1000;
+    std::vector<double> reference(count);
+    std::vector<double> result(count);
+    std::mt19937 generator(1);
+    std::normal_distribution<double> values(0.0, 1.0);
+    std::normal_distribution<double> errors(0.0, 0.01);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        reference[i] = values(generator);
+        result[i] = reference[i] + errors(generator) * (i % 7 == 0 ? 10.0 : 0.01);
+    }
+
+    // Special values are placed both inside the first vectors and close to the end
+    const double infinity = std::numeric_limits<double>::infinity();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const std::vector<double> specialResults{0.0, -0.0, 1.0, infinity, -infinity, nan, 1e-300, 5.0};
+    const std::vector<double> specialReferences{-0.0, 0.0, -1.0, infinity, infinity, 1.0, -1e-300, nan};
+
+    for (size_t i = 0; i < specialResults.size(); ++i)
+    {
+        result[10 + i] = specialResults[i];
+        reference[10 + i] = specialReferences[i];
+        result[count - 50 + 3 * i] = specialResults[i];
+        reference[count - 50 + 3 * i] = specialReferences[i];
+    }
+
+    const std::vector<float> floatResult(result.cbegin(), result.cend());
+    const std::vector<float> floatReference(reference.cbegin(), reference.cend());
+    std::vector<uint16_t> halfResult(count);
+    std::vector<uint16_t> halfReference(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const ktt::half resultElement(floatResult[i]);
+        const ktt::half referenceElement(floatReference[i]);
+        std::memcpy(&halfResult[i], &resultElement, sizeof(uint16_t));
+        std::memcpy(&halfReference[i], &referenceElement, sizeof(uint16_t));
+    }
+
+    checkKernelsAgree(kernels.doubleKernels, scalarKernels.doubleKernels, result, reference);
+    checkKernelsAgree(kernels.floatKernels, scalarKernels.floatKernels, floatResult, floatReference);
+    checkKernelsAgree(kernels.halfKernels, scalarKernels.halfKernels, halfResult, halfReference);
+}
+
+} // namespace
+
+TEST_CASE("Result comparison with tolerance", "Component: ResultComparator")
+{
+    ktt::ResultComparator comparator;
+
+    // Size is not a multiple of vector width and large enough to be split between threads
+    const size_t count = 3 * 1048576 + 7;
+    std::vector<float> reference(count, 1.0f);
+    std::vector<float> result(count, 1.0f);
+
+    SECTION("Equal data pass with all methods")
+    {
+        REQUIRE(comparator.compare(result.data(), reference.data(), count, ktt::ValidationMethod::AbsoluteDifference, 1e-4).passed);
+        REQUIRE(comparator.compare(result.data(), reference.data(), count, ktt::ValidationMethod::SideBySideComparison, 0.0).passed);
+        REQUIRE(comparator.compare(result.data(), reference.data(), count, ktt::ValidationMethod::SideBySideRelativeComparison, 0.0).passed);
+        REQUIRE(comparator.compare(result.data(), reference.data(), count, ktt::ValidationMethod::SideBySideUlpComparison, 0.0).passed);
+        REQUIRE(comparator.compare(result.data(), reference.data(), count, ktt::ValidationMethod::RootMeanSquareError, 0.0).passed);
+    }
+
+    SECTION("Differing element is found in the last partial vector")
+    {
+        result[count - 1] = 1.5f;
+        const ktt::ComparisonOutcome outcome = comparator.compare(result.data(), reference.data(), count,
+            ktt::ValidationMethod::SideBySideComparison, 0.25);
+
+        REQUIRE_FALSE(outcome.passed);
+        REQUIRE(outcome.index == count - 1);
+        REQUIRE(comparator.compare(result.data(), reference.data(), count, ktt::ValidationMethod::SideBySideComparison, 0.5).passed);
+    }
+
+    SECTION("Relative comparison ignores differences below absolute floor")
+    {
+        std::fill(reference.begin(), reference.end(), 1e-6f);
+        std::fill(result.begin(), result.end(), 2e-6f);
+        REQUIRE(comparator.compare(result.data(), reference.data(), count, ktt::ValidationMethod::SideBySideRelativeComparison, 0.1).passed);
+
+        result[1000] = 1.0f;
+        const ktt::ComparisonOutcome outcome = comparator.compare(result.data(), reference.data(), count,
+            ktt::ValidationMethod::SideBySideRelativeComparison, 0.1);
+        REQUIRE_FALSE(outcome.passed);
+        REQUIRE(outcome.index == 1000);
+    }
+
+    SECTION("Relative comparison floor is configurable")
+    {
+        std::fill(reference.begin(), reference.end(), -1e-6f);
+        std::fill(result.begin(), result.end(), -2e-6f);
+        comparator.setRelativeComparisonFloor(0.0);
+
+        const ktt::ComparisonOutcome outcome = comparator.compare(result.data(), reference.data(), count,
+            ktt::ValidationMethod::SideBySideRelativeComparison, 0.1);
+        REQUIRE_FALSE(outcome.passed);
+        REQUIRE(outcome.index == 0);
+        REQUIRE(comparator.compare(result.data(), reference.data(), count, ktt::ValidationMethod::SideBySideRelativeComparison, 1.5).passed);
+    }
+
+    SECTION("Distance in units in the last place is compared with tolerance")
+    {
+        result[count - 3] = std::nextafter(std::nextafter(1.0f, 2.0f), 2.0f);
+        result[2000] = std::nextafter(1.0f, 0.0f);
+
+        const ktt::ComparisonOutcome outcome = comparator.compare(result.data(), reference.data(), count,
+            ktt::ValidationMethod::SideBySideUlpComparison, 1.0);
+        REQUIRE_FALSE(outcome.passed);
+        REQUIRE(outcome.index == count - 3);
+        REQUIRE(outcome.statistics.maximumUlpDistance == 2);
+        REQUIRE(outcome.statistics.withinToleranceCount == count - 1);
+        REQUIRE(comparator.compare(result.data(), reference.data(), count, ktt::ValidationMethod::SideBySideUlpComparison, 2.0).passed);
+    }
+
+    SECTION("Zeros of different sign are equal and NaN always differs")
+    {
+        std::fill(reference.begin(), reference.end(), 0.0f);
+        std::fill(result.begin(), result.end(), -0.0f);
+        REQUIRE(comparator.compare(result.data(), reference.data(), count, ktt::ValidationMethod::SideBySideUlpComparison, 0.0).passed);
+
+        result[12345] = std::numeric_limits<float>::quiet_NaN();
+        const ktt::ComparisonOutcome outcome = comparator.compare(result.data(), reference.data(), count,
+            ktt::ValidationMethod::SideBySideUlpComparison, 1e30);
+        REQUIRE_FALSE(outcome.passed);
+        REQUIRE(outcome.index == 12345);
+        REQUIRE(outcome.statistics.maximumUlpDistance == UINT32_MAX);
+    }
+
+    SECTION("Root mean square error is compared with tolerance")
+    {
+        // Four differences of 0.5 in total count elements give error of sqrt(1 / count)
+        for (const size_t index : {size_t(0), size_t(1048576), size_t(2097152), count - 1})
+        {
+            result[index] = 1.5f;
+        }
+
+        const double error = std::sqrt(1.0 / static_cast<double>(count));
+        const ktt::ComparisonOutcome outcome = comparator.compare(result.data(), reference.data(), count,
+            ktt::ValidationMethod::RootMeanSquareError, error * 0.99);
+        REQUIRE_FALSE(outcome.passed);
+        REQUIRE(outcome.statistics.maximumDifference == 0.5);
+        REQUIRE(outcome.statistics.squaredDifferenceSum == 1.0);
+        REQUIRE(comparator.compare(result.data(), reference.data(), count, ktt::ValidationMethod::RootMeanSquareError, error * 1.01).passed);
+    }
+
+    SECTION("Sum of absolute differences is compared with tolerance")
+    {
+        result[10] = 1.25f;
+        result[count - 2] = 1.25f;
+        REQUIRE(comparator.compare(result.data(), reference.data(), count, ktt::ValidationMethod::AbsoluteDifference, 0.6).passed);
+        REQUIRE_FALSE(comparator.compare(result.data(), reference.data(), count, ktt::ValidationMethod::AbsoluteDifference, 0.4).passed);
+    }
+}
+
+TEST_CASE("Result comparison of half precision and exact data", "Component: ResultComparator")
+{
+    ktt::ResultComparator comparator;
+
+    SECTION("Half precision elements are compared with tolerance")
+    {
+        std::vector<ktt::half> reference(37, ktt::half(2.0f));
+        std::vector<ktt::half> result(37, ktt::half(2.0f));
+        result[33] = ktt::half(2.5f);
+
+        const ktt::ComparisonOutcome outcome = comparator.compare(result.data(), reference.data(), result.size(),
+            ktt::ValidationMethod::SideBySideComparison, 0.25);
+        REQUIRE_FALSE(outcome.passed);
+        REQUIRE(outcome.index == 33);
+        REQUIRE(comparator.compare(result.data(), reference.data(), result.size(), ktt::ValidationMethod::SideBySideComparison, 1.0).passed);
+    }
+
+    SECTION("Half precision elements are compared in units in the last place")
+    {
+        // Spacing of half precision values between 2 and 4 is 2^-9
+        std::vector<ktt::half> reference(37, ktt::half(2.0f));
+        std::vector<ktt::half> result(37, ktt::half(2.0f));
+        result[20] = ktt::half(2.0f + 3.0f / 512.0f);
+
+        const ktt::ComparisonOutcome outcome = comparator.compare(result.data(), reference.data(), result.size(),
+            ktt::ValidationMethod::SideBySideUlpComparison, 2.0);
+        REQUIRE_FALSE(outcome.passed);
+        REQUIRE(outcome.index == 20);
+        REQUIRE(outcome.statistics.maximumUlpDistance == 3);
+        REQUIRE(comparator.compare(result.data(), reference.data(), result.size(), ktt::ValidationMethod::SideBySideUlpComparison, 3.0).passed);
+    }
+
+    SECTION("Integer elements are compared exactly")
+    {
+        std::vector<int32_t> reference(100000, 5);
+        std::vector<int32_t> result(100000, 5);
+        REQUIRE(comparator.findDifference(result.data(), reference.data(), result.size(), sizeof(int32_t)) == result.size());
+
+        result[54321] = 6;
+        REQUIRE(comparator.findDifference(result.data(), reference.data(), result.size(), sizeof(int32_t)) == 54321);
+    }
+}
+
+TEST_CASE("Comparison kernels for vector instruction sets agree with scalar kernels", "Component: ResultComparator")
+{
+    const ktt::ComparisonKernelSet scalarKernels = ktt::getScalarComparisonKernels();
+
+    SECTION("Scalar kernels agree with themselves")
+    {
+        checkKernelSetsAgree(scalarKernels, scalarKernels);
+    }
+
+#if defined(__GNUC__)
+    __builtin_cpu_init();
+
+    SECTION("AVX2 kernels agree with scalar kernels")
+    {
+        if (__builtin_cpu_supports("avx2"))
+        {
+            checkKernelSetsAgree(ktt::getAvx2ComparisonKernels(), scalarKernels);
+        }
+    }
+
+    SECTION("AVX-512 kernels agree with scalar kernels")
+    {
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            checkKernelSetsAgree(ktt::getAvx512ComparisonKernels(), scalarKernels);
+        }
+    }
+#endif
+}
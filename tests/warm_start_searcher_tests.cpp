@@ -0,0 +1,80 @@
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <vector>
+#include <catch.hpp>
+#include <tuning_runner/configuration_manager.h>
+#include <utility/result_loader.h>
+
+TEST_CASE("Warm start from previous results", "Component: WarmStartSearcher")
+{
+    const std::string filePath = "warm_start_test_results.csv";
+    {
+        // Invalid results follow valid results after an empty line
+        std::ofstream file(filePath);
+        file << "Kernel name,Computation duration (us),Global size,Local size,A,B" << std::endl;
+        file << "kernel,20,16,1,1,2" << std::endl;
+        file << "kernel,10,16,1,3,4" << std::endl;
+        file << "kernel,50,16,1,4,1" << std::endl;
+        file << std::endl;
+        file << "Kernel name,Error message,Global size,Local size,A,B" << std::endl;
+        file << "kernel,Compilation failed,16,1,2,2" << std::endl;
+    }
+
+    ktt::Kernel kernel(0, "", "kernel", ktt::DimensionVector(16), ktt::DimensionVector(1));
+    kernel.addParameter(ktt::KernelParameter("A", std::vector<size_t>{1, 2, 3, 4}));
+    kernel.addParameter(ktt::KernelParameter("B", std::vector<size_t>{1, 2, 3, 4}));
+
+    ktt::ResultLoader loader;
+    REQUIRE(loader.loadResults(filePath, true));
+    const std::vector<std::vector<ktt::ParameterPair>> seeds = loader.getBestConfigurations(kernel.getParameters(), 2);
+    std::remove(filePath.c_str());
+
+    REQUIRE(seeds.size() == 2);
+    REQUIRE(seeds[0][0].getValue() == 3);
+    REQUIRE(seeds[1][0].getValue() == 1);
+
+    ktt::DeviceInfo deviceInfo(0, "Device");
+    deviceInfo.setMaxWorkGroupSize(1024);
+    ktt::ConfigurationManager manager(deviceInfo);
+    manager.initializeConfigurations(kernel);
+    manager.setWarmStartConfigurations(kernel.getId(), seeds);
+
+    std::vector<std::vector<ktt::ParameterPair>> visited;
+    std::set<std::pair<size_t, size_t>> distinct;
+    const size_t configurationCount = manager.getConfigurationCount(kernel.getId());
+
+    for (size_t i = 0; i < configurationCount; i++)
+    {
+        const ktt::KernelConfiguration configuration = manager.getCurrentConfiguration(kernel);
+        const std::vector<ktt::ParameterPair>& pairs = configuration.getParameterPairs();
+        visited.push_back(pairs);
+        distinct.insert(std::make_pair(pairs[0].getValue(), pairs[1].getValue()));
+
+        // The first seed is measured to be the fastest configuration
+        ktt::KernelResult result(kernel.getName(), configuration);
+        result.setComputationDuration(i == 0 ? 10 : 100 + i);
+        manager.calculateNextConfiguration(kernel, result);
+    }
+
+    SECTION("Seeded configurations are measured first")
+    {
+        REQUIRE(visited[0][0].getValue() == 3);
+        REQUIRE(visited[0][1].getValue() == 4);
+        REQUIRE(visited[1][0].getValue() == 1);
+        REQUIRE(visited[1][1].getValue() == 2);
+    }
+
+    SECTION("Neighbours of the best configuration follow the seeds")
+    {
+        for (size_t i = 2; i < 8; i++)
+        {
+            REQUIRE((visited[i][0].getValue() == 3 || visited[i][1].getValue() == 4));
+        }
+    }
+
+    SECTION("All configurations are explored exactly once")
+    {
+        REQUIRE(distinct.size() == configurationCount);
+    }
+}